@@ -117,11 +117,15 @@ PyAPI_FUNC(PyHash_FuncDef*) PyHash_GetFuncDef(void);
 
 /* hash algorithm selection
  *
- * The values for Py_HASH_SIPHASH24 and Py_HASH_FNV are hard-coded in the
- * configure script.
+ * The values for Py_HASH_SIPHASH24, Py_HASH_FNV and Py_HASH_SIPHASH13 are
+ * hard-coded in the configure script.
  *
  * - FNV is available on all platforms and architectures.
  * - SIPHASH24 only works on platforms that don't require aligned memory for integers.
+ * - SIPHASH13 is SipHash with one compression and three finalization rounds
+ *   instead of two and four.  It is noticeably faster, especially for short
+ *   inputs, and is still believed to resist hash flooding.  It has the same
+ *   platform requirements as SIPHASH24.
  * - With EXTERNAL embedders can provide an alternative implementation with::
  *
  *     PyHash_FuncDef PyHash_Func = {...};
@@ -131,6 +135,7 @@ PyAPI_FUNC(PyHash_FuncDef*) PyHash_GetFuncDef(void);
 #define Py_HASH_EXTERNAL 0
 #define Py_HASH_SIPHASH24 1
 #define Py_HASH_FNV 2
+#define Py_HASH_SIPHASH13 3
 
 #ifndef Py_HASH_ALGORITHM
 #  ifndef HAVE_ALIGNED_REQUIRED
@@ -1,6 +1,8 @@
 """Internal classes used by the gzip, lzma and bz2 modules"""
 
+import collections
 import io
+import os
 
 
 BUFFER_SIZE = io.DEFAULT_BUFFER_SIZE  # Compressed data read chunk size
@@ -150,3 +152,65 @@ def seek(self, offset, whence=io.SEEK_SET):
     def tell(self):
         """Return the current file position."""
         return self._pos
+
+
+class ThreadedCompressor:
+    """Compress data in fixed-size blocks on a pool of threads.
+
+    Subclasses implement _compress_block(block, previous, final), which is
+    called on a worker thread for each block; previous is the preceding
+    block, or None at the start of the stream.  compress() and flush()
+    return the results, passed through _output(), in block order.
+    """
+
+    def __init__(self, threads, block_size):
+        from concurrent.futures import ThreadPoolExecutor
+        if threads < 0:
+            raise ValueError("threads must be non-negative")
+        if threads == 0:
+            threads = os.cpu_count() or 1
+        self._executor = ThreadPoolExecutor(threads)
+        # Bound the memory used by blocks waiting to be written.
+        self._max_pending = 2 * threads
+        self._block_size = block_size
+        self._buffer = bytearray()
+        self._previous = None
+        self._pending = collections.deque()
+
+    def _submit(self, block, final):
+        self._pending.append(self._executor.submit(
+            self._compress_block, block, self._previous, final))
+        self._previous = block
+
+    def _collect(self, wait):
+        pending = self._pending
+        results = []
+        while pending and (wait or pending[0].done() or
+                           len(pending) > self._max_pending):
+            results.append(self._output(pending.popleft().result()))
+        return b"".join(results)
+
+    def _output(self, result):
+        return result
+
+    def compress(self, data):
+        buffer = self._buffer
+        buffer += data
+        size = self._block_size
+        while len(buffer) >= size:
+            self._submit(bytes(buffer[:size]), False)
+            del buffer[:size]
+        return self._collect(False)
+
+    def flush(self, final=True):
+        """Compress the buffered data and return all remaining output.
+
+        If final is false, compression can continue afterwards.
+        """
+        self._submit(bytes(self._buffer), final)
+        self._buffer.clear()
+        try:
+            return self._collect(True)
+        finally:
+            if final:
+                self._executor.shutdown()
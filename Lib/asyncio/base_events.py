@@ -742,6 +742,7 @@ def call_soon(self, callback, *args, context=None):
         Any positional arguments after the callback will be passed to
         the callback when it is called.
         """
+        # NOTE: this method is implemented in C (see _asynciomodule.c)
         self._check_closed()
         if self._debug:
             self._check_thread()
@@ -762,6 +763,7 @@ def _check_callback(self, callback, method):
                 f'got {callback!r}')
 
     def _call_soon(self, callback, args, context):
+        # NOTE: this method is implemented in C (see _asynciomodule.c)
         handle = events.Handle(callback, args, self, context)
         if handle._source_traceback:
             del handle._source_traceback[-1]
@@ -1810,7 +1812,7 @@ def _run_once(self):
         schedules the resulting callbacks, and finally schedules
         'call_later' callbacks.
         """
-
+        # NOTE: this method is implemented in C (see _asynciomodule.c)
         sched_count = len(self._scheduled)
         if (sched_count > _MIN_SCHEDULED_TIMER_HANDLES and
             self._timer_cancelled_count / sched_count >
@@ -1904,3 +1906,27 @@ def set_debug(self, enabled):
 
         if self.is_running():
             self.call_soon_threadsafe(self._set_coroutine_origin_tracking, enabled)
+
+
+# Alias pure-Python implementations for testing purposes.
+_py_call_soon = BaseEventLoop.call_soon
+_py__call_soon = BaseEventLoop._call_soon
+_py__run_once = BaseEventLoop._run_once
+
+
+try:
+    # call_soon() runs for every scheduled callback and _run_once() for
+    # every loop iteration; the C implementations drive the ready queue
+    # and the timer heap without going through the interpreter.
+    from _asyncio import _base_event_loop_methods
+except ImportError:
+    pass
+else:
+    for _name, _method in _base_event_loop_methods(BaseEventLoop).items():
+        setattr(BaseEventLoop, _name, _method)
+    del _name, _method
+
+    # Alias C implementations for testing purposes.
+    _c_call_soon = BaseEventLoop.call_soon
+    _c__call_soon = BaseEventLoop._call_soon
+    _c__run_once = BaseEventLoop._run_once
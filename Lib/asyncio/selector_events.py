@@ -11,6 +11,7 @@
 import functools
 import selectors
 import socket
+import sys
 import warnings
 import weakref
 try:
@@ -754,11 +755,29 @@ def _add_reader(self, fd, callback, *args):
         self._loop._add_reader(fd, callback, *args)
 
 
+def _zerocopy_enabled(sock):
+    if (not hasattr(sock, 'zerocopy_completions') or
+            sock.family not in (socket.AF_INET, socket.AF_INET6)):
+        return False
+    try:
+        return bool(sock.getsockopt(socket.SOL_SOCKET, socket.SO_ZEROCOPY))
+    except OSError:
+        return False
+
+
 class _SelectorSocketTransport(_SelectorTransport):
 
     _start_tls_compatible = True
     _sendfile_compatible = constants._SendfileMode.TRY_NATIVE
 
+    # If SO_ZEROCOPY is enabled on the socket, bytes objects of at least
+    # this size are written with MSG_ZEROCOPY.  The socket keeps them until
+    # the kernel reports their completion, which the transport reads when
+    # the selector wakes it up; on smaller writes copying is cheaper.
+    _zerocopy_threshold = 64 * 1024
+    # Delay between two checks for pending completions when closing.
+    _zerocopy_close_delay = 0.001
+
     def __init__(self, loop, sock, protocol, waiter=None,
                  extra=None, server=None):
 
@@ -767,6 +786,8 @@ def __init__(self, loop, sock, protocol, waiter=None,
         self._eof = False
         self._paused = False
         self._empty_waiter = None
+        self._zerocopy = _zerocopy_enabled(sock)
+        self._zerocopy_pending = 0
 
         # Disable the Nagle algorithm -- small writes will be
         # sent without waiting for the TCP ACK.  This generally
@@ -810,8 +831,31 @@ def resume_reading(self):
             logger.debug("%r resumes reading", self)
 
     def _read_ready(self):
+        if self._zerocopy_pending:
+            self._read_zerocopy_completions()
         self._read_ready_cb()
 
+    def _read_zerocopy_completions(self):
+        # Pending completions make the selector report the socket as
+        # readable and writable until they are read.
+        try:
+            completions = self._sock.zerocopy_completions()
+        except (BlockingIOError, InterruptedError):
+            return
+        except OSError as exc:
+            if self._closing:
+                # Stop waiting for the completions.
+                self._zerocopy_pending = 0
+            else:
+                self._fatal_error(exc, 'Fatal error on socket transport')
+            return
+        for first, last, copied in completions:
+            self._zerocopy_pending -= ((last - first) & 0xffffffff) + 1
+            if copied:
+                # The kernel copied the data anyway (e.g. on the loopback
+                # interface): MSG_ZEROCOPY only adds overhead.
+                self._zerocopy = False
+
     def _read_ready__get_buffer(self):
         if self._conn_lost:
             return
@@ -915,7 +959,12 @@ def write(self, data):
         if not self._buffer:
             # Optimization: try to send now.
             try:
-                n = self._sock.send(data)
+                if (self._zerocopy and type(data) is bytes and
+                        len(data) >= self._zerocopy_threshold):
+                    n = self._sock.send(data, socket.MSG_ZEROCOPY)
+                    self._zerocopy_pending += 1
+                else:
+                    n = self._sock.send(data)
             except (BlockingIOError, InterruptedError):
                 pass
             except (SystemExit, KeyboardInterrupt):
@@ -939,6 +988,10 @@ def _write_ready(self):
 
         if self._conn_lost:
             return
+        if self._zerocopy_pending:
+            self._read_zerocopy_completions()
+            if self._conn_lost:
+                return
         try:
             n = self._sock.send(self._buffer)
         except (BlockingIOError, InterruptedError):
@@ -974,7 +1027,22 @@ def write_eof(self):
     def can_write_eof(self):
         return True
 
+    def _force_close(self, exc):
+        # Closing the socket releases the buffers of MSG_ZEROCOPY writes
+        # without waiting for their completion.
+        self._zerocopy_pending = 0
+        super()._force_close(exc)
+
     def _call_connection_lost(self, exc):
+        if self._zerocopy_pending:
+            # The kernel may still be sending the data of MSG_ZEROCOPY
+            # writes, and the socket releases their buffers when it is
+            # closed: wait until the kernel is done with them.
+            self._read_zerocopy_completions()
+            if self._zerocopy_pending:
+                self._loop.call_later(self._zerocopy_close_delay,
+                                      self._call_connection_lost, exc)
+                return
         super()._call_connection_lost(exc)
         if self._empty_waiter is not None:
             self._empty_waiter.set_exception(
@@ -996,10 +1064,36 @@ class _SelectorDatagramTransport(_SelectorTransport):
 
     _buffer_factory = collections.deque
 
+    # Once a UDP transport has received this many datagrams one at a
+    # time, switch to receiving up to _recv_batch_size datagrams per
+    # readiness event with socket.recvmmsg_into().  The batch buffers are
+    # released, and datagrams counted again, as soon as a readiness event
+    # yields a single datagram: endpoints that are not receiving bursts
+    # (e.g. one DNS query) do not keep them.
+    _recv_batch_threshold = 64
+    _recv_batch_size = 16
+    # Each batch buffer holds the largest datagram received so far, rounded
+    # up to a power of two and at least _recv_batch_bufsize bytes.  A
+    # datagram that does not fit is lost: it is reported to the protocol
+    # with error_received(), and the transport goes back to recvfrom()
+    # until the next batch, whose buffers will be large enough for it.
+    _recv_batch_bufsize = 2048
+    # On Linux, MSG_TRUNC makes recvmmsg() return the real size of a
+    # truncated datagram.
+    _recv_batch_flags = (socket.MSG_TRUNC if sys.platform == 'linux'
+                         else 0)
+
     def __init__(self, loop, sock, protocol, address=None,
                  waiter=None, extra=None):
         super().__init__(loop, sock, protocol, extra)
         self._address = address
+        self._recv_bufs = None
+        self._recv_max_nbytes = 0
+        if (hasattr(sock, 'recvmmsg_into') and
+                sock.family in (socket.AF_INET, socket.AF_INET6)):
+            self._recv_batch_countdown = self._recv_batch_threshold
+        else:
+            self._recv_batch_countdown = None
         self._loop.call_soon(self._protocol.connection_made, self)
         # only start reading when connection_made() has been called
         self._loop.call_soon(self._add_reader,
@@ -1015,6 +1109,9 @@ def get_write_buffer_size(self):
     def _read_ready(self):
         if self._conn_lost:
             return
+        if self._recv_bufs is not None:
+            self._read_ready__batch()
+            return
         try:
             data, addr = self._sock.recvfrom(self.max_size)
         except (BlockingIOError, InterruptedError):
@@ -1027,6 +1124,52 @@ def _read_ready(self):
             self._fatal_error(exc, 'Fatal read error on datagram transport')
         else:
             self._protocol.datagram_received(data, addr)
+            if self._recv_batch_countdown is not None:
+                self._recv_max_nbytes = max(self._recv_max_nbytes, len(data))
+                self._recv_batch_countdown -= 1
+                if self._recv_batch_countdown <= 0:
+                    self._recv_batch_countdown = None
+                    bufsize = self._recv_batch_bufsize
+                    while bufsize < self._recv_max_nbytes:
+                        bufsize *= 2
+                    buf = memoryview(
+                        bytearray(bufsize * self._recv_batch_size))
+                    self._recv_bufs = [buf[i:i + bufsize]
+                                       for i in range(0, len(buf), bufsize)]
+
+    def _read_ready__batch(self):
+        try:
+            received = self._sock.recvmmsg_into(self._recv_bufs,
+                                                self._recv_batch_flags)
+        except (BlockingIOError, InterruptedError):
+            return
+        except OSError as exc:
+            self._protocol.error_received(exc)
+            return
+        except (SystemExit, KeyboardInterrupt):
+            raise
+        except BaseException as exc:
+            self._fatal_error(exc, 'Fatal read error on datagram transport')
+            return
+        bufs = self._recv_bufs
+        if len(received) <= 1 or any(flags & socket.MSG_TRUNC
+                                     for _, _, flags in received):
+            self._recv_bufs = None
+            self._recv_batch_countdown = self._recv_batch_threshold
+        for buf, (nbytes, addr, flags) in zip(bufs, received):
+            if self._conn_lost or self._closing:
+                break
+            if flags & socket.MSG_TRUNC:
+                # nbytes is the size of the lost datagram if it is known;
+                # either way, the next batch buffers will be larger.
+                self._recv_max_nbytes = max(self._recv_max_nbytes, nbytes,
+                                            len(buf) + 1)
+                self._protocol.error_received(OSError(
+                    errno.EMSGSIZE,
+                    f'datagram from {addr!r} larger than {len(buf)} bytes '
+                    f'was truncated and dropped'))
+                continue
+            self._protocol.datagram_received(bytes(buf[:nbytes]), addr)
 
     def sendto(self, data, addr=None):
         if not isinstance(data, (bytes, bytearray, memoryview)):
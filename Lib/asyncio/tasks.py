@@ -6,6 +6,7 @@
     'wait', 'wait_for', 'as_completed', 'sleep',
     'gather', 'shield', 'ensure_future', 'run_coroutine_threadsafe',
     'current_task', 'all_tasks',
+    'create_eager_task_factory', 'eager_task_factory',
     '_register_task', '_unregister_task', '_enter_task', '_leave_task',
 )
 
@@ -89,7 +90,7 @@ class Task(futures._PyFuture):  # Inherit Python Task implementation
     # status is still pending
     _log_destroy_pending = True
 
-    def __init__(self, coro, *, loop=None, name=None):
+    def __init__(self, coro, *, loop=None, name=None, eager_start=False):
         super().__init__(loop=loop)
         if self._source_traceback:
             del self._source_traceback[-1]
@@ -109,8 +110,11 @@ def __init__(self, coro, *, loop=None, name=None):
         self._coro = coro
         self._context = contextvars.copy_context()
 
-        self._loop.call_soon(self.__step, context=self._context)
-        _register_task(self)
+        if eager_start and self._loop.is_running():
+            self.__eager_start()
+        else:
+            self._loop.call_soon(self.__step, context=self._context)
+            _register_task(self)
 
     def __del__(self):
         if self._state == futures._PENDING and self._log_destroy_pending:
@@ -212,6 +216,16 @@ def cancel(self, msg=None):
         self._cancel_message = msg
         return True
 
+    def __eager_start(self):
+        # Run the first step right away, on top of the task that is
+        # creating this one, instead of waiting for the next loop iteration.
+        prev_task = _swap_current_task(self._loop, None)
+        try:
+            _register_task(self)
+            self._context.run(self.__step)
+        finally:
+            _swap_current_task(self._loop, prev_task)
+
     def __step(self, exc=None):
         if self.done():
             raise exceptions.InvalidStateError(
@@ -328,6 +342,28 @@ def __wakeup(self, future):
     Task = _CTask = _asyncio.Task
 
 
+def create_eager_task_factory(custom_task_constructor):
+    """Create a task factory that starts tasks eagerly.
+
+    The returned factory can be passed to loop.set_task_factory().  Tasks
+    it creates run their coroutine synchronously until the first point
+    where it would block; a coroutine that finishes without blocking
+    produces an already-done task and is never scheduled on the loop.
+
+    custom_task_constructor must accept the same arguments as Task,
+    including the eager_start keyword.
+    """
+
+    def factory(loop, coro, *, name=None):
+        return custom_task_constructor(
+            coro, loop=loop, name=name, eager_start=True)
+
+    return factory
+
+
+eager_task_factory = create_eager_task_factory(Task)
+
+
 def create_task(coro, *, name=None):
     """Schedule the execution of a coroutine object in a spawn task.
 
@@ -900,6 +936,15 @@ def _enter_task(loop, task):
     _current_tasks[loop] = task
 
 
+def _swap_current_task(loop, task):
+    prev_task = _current_tasks.get(loop)
+    if task is None:
+        _current_tasks.pop(loop, None)
+    else:
+        _current_tasks[loop] = task
+    return prev_task
+
+
 def _leave_task(loop, task):
     current_task = _current_tasks.get(loop)
     if current_task is not task:
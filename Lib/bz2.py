@@ -24,6 +24,30 @@
 _MODE_WRITE    = 3
 
 
+class _ThreadedBZ2Compressor(_compression.ThreadedCompressor):
+    """Compressor object compressing blocks in parallel, each one into a
+    complete bzip2 stream.  Decompressors read the concatenated streams as
+    a single one.
+    """
+
+    def __init__(self, compresslevel, threads):
+        # One bzip2 block per stream.
+        super().__init__(threads, compresslevel * 100000)
+        self._compresslevel = compresslevel
+
+    def _compress_block(self, block, previous, final):
+        if not block and previous is not None:
+            return b""
+        comp = BZ2Compressor(self._compresslevel)
+        return comp.compress(block) + comp.flush()
+
+
+def _make_compressor(compresslevel, threads):
+    if threads == 1:
+        return BZ2Compressor(compresslevel)
+    return _ThreadedBZ2Compressor(compresslevel, threads)
+
+
 class BZ2File(_compression.BaseStream):
 
     """A file object providing transparent bzip2 (de)compression.
@@ -35,7 +59,7 @@ class BZ2File(_compression.BaseStream):
     returned as bytes, and data to be written should be given as bytes.
     """
 
-    def __init__(self, filename, mode="r", *, compresslevel=9):
+    def __init__(self, filename, mode="r", *, compresslevel=9, threads=1):
         """Open a bzip2-compressed file.
 
         If filename is a str, bytes, or PathLike object, it gives the
@@ -50,6 +74,11 @@ def __init__(self, filename, mode="r", *, compresslevel=9):
         and 9 specifying the level of compression: 1 produces the least
         compression, and 9 (default) produces the most compression.
 
+        If mode is 'w', 'x' or 'a', threads is the number of threads
+        used to compress the data, or 0 to use one thread per CPU.  With
+        more than one thread, the output is a concatenation of bzip2
+        streams of one block each.
+
         If mode is 'r', the input file may be the concatenation of
         multiple compressed streams.
         """
@@ -64,20 +93,23 @@ def __init__(self, filename, mode="r", *, compresslevel=9):
             raise ValueError("compresslevel must be between 1 and 9")
 
         if mode in ("", "r", "rb"):
+            if threads != 1:
+                raise ValueError("Cannot specify the number of threads "
+                                 "when opening a file for reading")
             mode = "rb"
             mode_code = _MODE_READ
         elif mode in ("w", "wb"):
             mode = "wb"
             mode_code = _MODE_WRITE
-            self._compressor = BZ2Compressor(compresslevel)
+            self._compressor = _make_compressor(compresslevel, threads)
         elif mode in ("x", "xb"):
             mode = "xb"
             mode_code = _MODE_WRITE
-            self._compressor = BZ2Compressor(compresslevel)
+            self._compressor = _make_compressor(compresslevel, threads)
         elif mode in ("a", "ab"):
             mode = "ab"
             mode_code = _MODE_WRITE
-            self._compressor = BZ2Compressor(compresslevel)
+            self._compressor = _make_compressor(compresslevel, threads)
         else:
             raise ValueError("Invalid mode: %r" % (mode,))
 
@@ -276,7 +308,7 @@ def tell(self):
 
 
 def open(filename, mode="rb", compresslevel=9,
-         encoding=None, errors=None, newline=None):
+         encoding=None, errors=None, newline=None, *, threads=1):
     """Open a bzip2-compressed file in binary or text mode.
 
     The filename argument can be an actual filename (a str, bytes, or
@@ -288,8 +320,8 @@ def open(filename, mode="rb", compresslevel=9,
     The default mode is "rb", and the default compresslevel is 9.
 
     For binary mode, this function is equivalent to the BZ2File
-    constructor: BZ2File(filename, mode, compresslevel). In this case,
-    the encoding, errors and newline arguments must not be provided.
+    constructor: BZ2File(filename, mode, compresslevel, threads). In this
+    case, the encoding, errors and newline arguments must not be provided.
 
     For text mode, a BZ2File object is created, and wrapped in an
     io.TextIOWrapper instance with the specified encoding, error
@@ -308,7 +340,8 @@ def open(filename, mode="rb", compresslevel=9,
             raise ValueError("Argument 'newline' not supported in binary mode")
 
     bz_mode = mode.replace("t", "")
-    binary_file = BZ2File(filename, bz_mode, compresslevel=compresslevel)
+    binary_file = BZ2File(filename, bz_mode, compresslevel=compresslevel,
+                          threads=threads)
 
     if "t" in mode:
         return io.TextIOWrapper(binary_file, encoding, errors, newline)
@@ -316,14 +349,17 @@ def open(filename, mode="rb", compresslevel=9,
         return binary_file
 
 
-def compress(data, compresslevel=9):
+def compress(data, compresslevel=9, *, threads=1):
     """Compress a block of data.
 
     compresslevel, if given, must be a number between 1 and 9.
 
+    threads is the number of threads used, or 0 to use one thread per
+    CPU; see BZ2File.
+
     For incremental compression, use a BZ2Compressor object instead.
     """
-    comp = BZ2Compressor(compresslevel)
+    comp = _make_compressor(compresslevel, threads)
     return comp.compress(data) + comp.flush()
 
 
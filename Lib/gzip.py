@@ -23,7 +23,7 @@
 
 
 def open(filename, mode="rb", compresslevel=_COMPRESS_LEVEL_BEST,
-         encoding=None, errors=None, newline=None):
+         encoding=None, errors=None, newline=None, *, threads=1):
     """Open a gzip-compressed file in binary or text mode.
 
     The filename argument can be an actual filename (a str or bytes object), or
@@ -34,8 +34,8 @@ def open(filename, mode="rb", compresslevel=_COMPRESS_LEVEL_BEST,
     "rb", and the default compresslevel is 9.
 
     For binary mode, this function is equivalent to the GzipFile constructor:
-    GzipFile(filename, mode, compresslevel). In this case, the encoding, errors
-    and newline arguments must not be provided.
+    GzipFile(filename, mode, compresslevel, threads=threads). In this case, the
+    encoding, errors and newline arguments must not be provided.
 
     For text mode, a GzipFile object is created, and wrapped in an
     io.TextIOWrapper instance with the specified encoding, error handling
@@ -55,9 +55,11 @@ def open(filename, mode="rb", compresslevel=_COMPRESS_LEVEL_BEST,
 
     gz_mode = mode.replace("t", "")
     if isinstance(filename, (str, bytes, os.PathLike)):
-        binary_file = GzipFile(filename, gz_mode, compresslevel)
+        binary_file = GzipFile(filename, gz_mode, compresslevel,
+                               threads=threads)
     elif hasattr(filename, "read") or hasattr(filename, "write"):
-        binary_file = GzipFile(None, gz_mode, compresslevel, filename)
+        binary_file = GzipFile(None, gz_mode, compresslevel, filename,
+                               threads=threads)
     else:
         raise TypeError("filename must be a str or bytes object, or a file")
 
@@ -71,6 +73,49 @@ def write32u(output, value):
     # or unsigned.
     output.write(struct.pack("<L", value))
 
+class _ThreadedDeflater(_compression.ThreadedCompressor):
+    """Compressor object producing a single raw deflate stream from blocks
+    compressed in parallel, as pigz does.
+
+    Each block is primed with the last 32 KiB of the previous block and,
+    except for the last one, ends on a byte boundary with Z_SYNC_FLUSH, so
+    that the compressed blocks can simply be concatenated.  The CRC-32 of
+    each block is also computed on the worker threads.
+    """
+
+    _block_size = 128 * 1024
+
+    def __init__(self, compresslevel, threads):
+        super().__init__(threads, self._block_size)
+        self._compresslevel = compresslevel
+        self.crc = zlib.crc32(b"")
+
+    def _compress_block(self, block, previous, final):
+        if previous:
+            comp = zlib.compressobj(self._compresslevel, zlib.DEFLATED,
+                                    -zlib.MAX_WBITS, zlib.DEF_MEM_LEVEL, 0,
+                                    previous[-32768:])
+        else:
+            comp = zlib.compressobj(self._compresslevel, zlib.DEFLATED,
+                                    -zlib.MAX_WBITS, zlib.DEF_MEM_LEVEL, 0)
+        data = comp.compress(block)
+        data += comp.flush(zlib.Z_FINISH if final else zlib.Z_SYNC_FLUSH)
+        return data, zlib.crc32(block), len(block)
+
+    def _output(self, result):
+        data, crc, length = result
+        self.crc = zlib.crc32_combine(self.crc, crc, length)
+        return data
+
+    def flush(self, mode=zlib.Z_FINISH):
+        if mode == zlib.Z_NO_FLUSH:
+            return b""
+        data = super().flush(mode == zlib.Z_FINISH)
+        if mode == zlib.Z_FULL_FLUSH:
+            # Later blocks must not refer to the data written so far.
+            self._previous = None
+        return data
+
 class _PaddedFile:
     """Minimal read-only file object that prepends a string to the contents
     of an actual file. Shouldn't be used outside of gzip.py, as it lacks
@@ -131,7 +176,8 @@ class GzipFile(_compression.BaseStream):
     myfileobj = None
 
     def __init__(self, filename=None, mode=None,
-                 compresslevel=_COMPRESS_LEVEL_BEST, fileobj=None, mtime=None):
+                 compresslevel=_COMPRESS_LEVEL_BEST, fileobj=None, mtime=None,
+                 *, threads=1):
         """Constructor for the GzipFile class.
 
         At least one of fileobj and filename must be given a
@@ -163,6 +209,12 @@ def __init__(self, filename=None, mode=None,
         to the last modification time field in the stream when compressing.
         If omitted or None, the current time is used.
 
+        The threads argument is the number of threads used to compress the
+        data written, or 0 to use one thread per CPU.  With more than one
+        thread, the data is compressed in independent 128 KiB blocks, which
+        gives slightly larger output.  It can only be used when opening a
+        file for writing.
+
         """
 
         if mode and ('t' in mode or 'U' in mode):
@@ -182,6 +234,9 @@ def __init__(self, filename=None, mode=None,
             mode = getattr(fileobj, 'mode', 'rb')
 
         if mode.startswith('r'):
+            if threads != 1:
+                raise ValueError("Cannot specify the number of threads "
+                                 "when opening a file for reading")
             self.mode = READ
             raw = _GzipReader(fileobj)
             self._buffer = io.BufferedReader(raw)
@@ -197,11 +252,14 @@ def __init__(self, filename=None, mode=None,
                     FutureWarning, 2)
             self.mode = WRITE
             self._init_write(filename)
-            self.compress = zlib.compressobj(compresslevel,
-                                             zlib.DEFLATED,
-                                             -zlib.MAX_WBITS,
-                                             zlib.DEF_MEM_LEVEL,
-                                             0)
+            if threads == 1:
+                self.compress = zlib.compressobj(compresslevel,
+                                                 zlib.DEFLATED,
+                                                 -zlib.MAX_WBITS,
+                                                 zlib.DEF_MEM_LEVEL,
+                                                 0)
+            else:
+                self.compress = _ThreadedDeflater(compresslevel, threads)
             self._write_mtime = mtime
         else:
             raise ValueError("Invalid mode: {!r}".format(mode))
@@ -287,7 +345,10 @@ def write(self,data):
         if length > 0:
             self.fileobj.write(self.compress.compress(data))
             self.size += length
-            self.crc = zlib.crc32(data, self.crc)
+            if isinstance(self.compress, _ThreadedDeflater):
+                self.crc = self.compress.crc
+            else:
+                self.crc = zlib.crc32(data, self.crc)
             self.offset += length
 
         return length
@@ -331,6 +392,8 @@ def close(self):
         try:
             if self.mode == WRITE:
                 fileobj.write(self.compress.flush())
+                if isinstance(self.compress, _ThreadedDeflater):
+                    self.crc = self.compress.crc
                 write32u(fileobj, self.crc)
                 # self.size may exceed 2 GiB, or even 4 GiB
                 write32u(fileobj, self.size & 0xffffffff)
@@ -539,12 +602,14 @@ def _rewind(self):
         super()._rewind()
         self._new_member = True
 
-def compress(data, compresslevel=_COMPRESS_LEVEL_BEST, *, mtime=None):
+def compress(data, compresslevel=_COMPRESS_LEVEL_BEST, *, mtime=None,
+             threads=1):
     """Compress data in one shot and return the compressed string.
     Optional argument is the compression level, in range of 0-9.
     """
     buf = io.BytesIO()
-    with GzipFile(fileobj=buf, mode='wb', compresslevel=compresslevel, mtime=mtime) as f:
+    with GzipFile(fileobj=buf, mode='wb', compresslevel=compresslevel,
+                  mtime=mtime, threads=threads) as f:
         f.write(data)
     return buf.getvalue()
 
@@ -1,5 +1,6 @@
 """Implementation of JSONDecoder
 """
+import codecs
 import re
 
 from json import scanner
@@ -49,6 +50,40 @@ def __reduce__(self):
     'NaN': NaN,
 }
 
+_LITERALS = ('true', 'false', 'null', '-Infinity', 'Infinity', 'NaN')
+# What may follow a number at the end of a chunk if the number continues
+# in the next one.
+_NUMBER_TAIL = re.compile(r'(?:\.|[eE][-+]?)\Z')
+
+
+def _maybe_truncated(err, s):
+    """Return true if the JSONDecodeError *err*, raised on *s*, may go
+    away once more text is appended to *s*."""
+    rest = s[err.pos:]
+    if not rest or err.msg.startswith('Unterminated string'):
+        return True
+    if err.msg.startswith('Invalid \\uXXXX escape'):
+        return len(rest) <= 5
+    return (_NUMBER_TAIL.match(rest) is not None or
+            any(lit.startswith(rest) for lit in _LITERALS))
+
+
+def _rebase_error(err, consumed, lines, linestart):
+    """Make the position of the JSONDecodeError *err* relative to the
+    start of a stream, *consumed* characters of which, including *lines*
+    newlines, were dropped before *err.doc*.  The last line dropped starts
+    at index *linestart* of the stream."""
+    pos = err.pos
+    nl = err.doc.rfind('\n', 0, pos)
+    if nl < 0:
+        err.colno = consumed + pos - linestart + 1
+    else:
+        err.colno = pos - nl
+    err.lineno = lines + err.doc.count('\n', 0, pos) + 1
+    err.pos = pos = consumed + pos
+    err.args = ('%s: line %d column %d (char %d)' %
+                (err.msg, err.lineno, err.colno, pos),)
+
 
 STRINGCHUNK = re.compile(r'(.*?)(["\\\x00-\x1f])', FLAGS)
 BACKSLASH = {
@@ -354,3 +389,86 @@ def raw_decode(self, s, idx=0):
         except StopIteration as err:
             raise JSONDecodeError("Expecting value", s, err.value) from None
         return obj, end
+
+    def iterdecode(self, chunks, _w=WHITESPACE.match):
+        """Decode a stream of JSON documents separated by optional
+        whitespace, such as JSON Lines, yielding each Python object as
+        soon as the document is complete.
+
+        ``chunks`` is an iterable of ``str``, or of ``bytes`` containing
+        UTF-8 text.  Only a small window of the stream is held in memory
+        at a time, unless a single document spans many chunks.
+
+        """
+        utf8 = None
+        buf = ''
+        pos = 0
+        # Number of characters and of newlines dropped from the start of
+        # the stream, and index of the first character of the last line
+        # dropped; used to report error positions in the whole stream.
+        consumed = lines = linestart = 0
+        pending = []
+        pending_len = 0
+        # Length of the incomplete document at the last failed attempt.
+        # Parsing is not retried until twice as much text is available,
+        # so that a document spanning many chunks is only scanned a
+        # logarithmic number of times.
+        need = 0
+        for chunk in chunks:
+            if not isinstance(chunk, str):
+                if utf8 is None:
+                    utf8 = codecs.getincrementaldecoder('utf-8-sig')()
+                chunk = utf8.decode(chunk)
+            pending.append(chunk)
+            pending_len += len(chunk)
+            if len(buf) - pos + pending_len < need:
+                continue
+            if pos:
+                lines += buf.count('\n', 0, pos)
+                nl = buf.rfind('\n', 0, pos)
+                if nl >= 0:
+                    linestart = consumed + nl + 1
+                consumed += pos
+            buf = buf[pos:] + ''.join(pending)
+            pos = 0
+            pending.clear()
+            pending_len = 0
+            while True:
+                pos = _w(buf, pos).end()
+                if pos == len(buf):
+                    break
+                try:
+                    obj, end = self.raw_decode(buf, pos)
+                except JSONDecodeError as err:
+                    if not _maybe_truncated(err, buf):
+                        _rebase_error(err, consumed, lines, linestart)
+                        raise
+                    # The document may continue in the next chunk.
+                    need = 2 * (len(buf) - pos)
+                    break
+                need = 0
+                if ((end == len(buf) and buf[end - 1] in '0123456789') or
+                        _NUMBER_TAIL.match(buf, end)):
+                    # A number may continue in the next chunk.  Any other
+                    # document is complete once it has been decoded.
+                    break
+                yield obj
+                pos = end
+        if utf8 is not None:
+            pending.append(utf8.decode(b'', True))
+        if pos:
+            lines += buf.count('\n', 0, pos)
+            nl = buf.rfind('\n', 0, pos)
+            if nl >= 0:
+                linestart = consumed + nl + 1
+            consumed += pos
+        buf = buf[pos:] + ''.join(pending)
+        pos = _w(buf, 0).end()
+        while pos != len(buf):
+            try:
+                obj, end = self.raw_decode(buf, pos)
+            except JSONDecodeError as err:
+                _rebase_error(err, consumed, lines, linestart)
+                raise
+            yield obj
+            pos = _w(buf, end).end()
@@ -201,7 +201,7 @@ def encode(self, o):
             chunks = list(chunks)
         return ''.join(chunks)
 
-    def iterencode(self, o, _one_shot=False):
+    def iterencode(self, o, _one_shot=False, _write=None):
         """Encode the given object and yield each string
         representation as available.
 
@@ -211,6 +211,8 @@ def iterencode(self, o, _one_shot=False):
                 mysocket.write(chunk)
 
         """
+        # If _write is given, it is called with each chunk instead, and
+        # None is returned.  This lets json.dump() use the C encoder.
         if self.check_circular:
             markers = {}
         else:
@@ -243,17 +245,27 @@ def floatstr(o, allow_nan=self.allow_nan,
             return text
 
 
-        if (_one_shot and c_make_encoder is not None
-                and self.indent is None):
+        if self.indent is None or isinstance(self.indent, str):
+            indent = self.indent
+        else:
+            indent = ' ' * self.indent
+        if (c_make_encoder is not None
+                and (_one_shot or _write is not None)):
             _iterencode = c_make_encoder(
-                markers, self.default, _encoder, self.indent,
+                markers, self.default, _encoder, indent,
                 self.key_separator, self.item_separator, self.sort_keys,
                 self.skipkeys, self.allow_nan)
+            if _write is not None:
+                return _iterencode(o, 0, _write)
         else:
             _iterencode = _make_iterencode(
-                markers, self.default, _encoder, self.indent, floatstr,
+                markers, self.default, _encoder, indent, floatstr,
                 self.key_separator, self.item_separator, self.sort_keys,
                 self.skipkeys, _one_shot)
+            if _write is not None:
+                for chunk in _iterencode(o, 0):
+                    _write(chunk)
+                return None
         return _iterencode(o, 0)
 
 def _make_iterencode(markers, _default, _encoder, _indent, _floatstr,
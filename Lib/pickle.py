@@ -1182,6 +1182,7 @@ def __init__(self, file, *, fix_imports=True,
         self.errors = errors
         self.proto = 0
         self.fix_imports = fix_imports
+        self._source = None
 
     def load(self):
         """Read a pickled object representation from the open file.
@@ -1387,11 +1388,31 @@ def load_bytearray8(self):
         if len > maxsize:
             raise UnpicklingError("BYTEARRAY8 exceeds system's maximum size "
                                   "of %d bytes" % maxsize)
+        if self._source is not None:
+            self.append(self._read_view(len))
+            return
         b = bytearray(len)
         self.readinto(b)
         self.append(b)
     dispatch[BYTEARRAY8[0]] = load_bytearray8
 
+    def _read_view(self, n):
+        # Used by loads(zero_copy=True): return a memoryview of the next
+        # n bytes of the source buffer unless they were copied in a frame.
+        view, file = self._source
+        frame = self._unframer.current_frame
+        if frame:
+            pos = frame.tell()
+            if frame.seek(0, io.SEEK_END) != pos:
+                frame.seek(pos)
+                return memoryview(self.read(n))
+            self._unframer.current_frame = None
+        start = file.tell()
+        if n > len(view) - start:
+            raise UnpicklingError("pickle data was truncated")
+        file.seek(n, io.SEEK_CUR)
+        return view[start:start + n]
+
     def load_next_buffer(self):
         if self._buffers is None:
             raise UnpicklingError("pickle stream refers to out-of-band data "
@@ -1764,12 +1785,15 @@ def _load(file, *, fix_imports=True, encoding="ASCII", errors="strict",
                      encoding=encoding, errors=errors).load()
 
 def _loads(s, /, *, fix_imports=True, encoding="ASCII", errors="strict",
-           buffers=None):
+           buffers=None, zero_copy=False):
     if isinstance(s, str):
         raise TypeError("Can't load pickle from unicode string")
     file = io.BytesIO(s)
-    return _Unpickler(file, fix_imports=fix_imports, buffers=buffers,
-                      encoding=encoding, errors=errors).load()
+    unpickler = _Unpickler(file, fix_imports=fix_imports, buffers=buffers,
+                           encoding=encoding, errors=errors)
+    if zero_copy:
+        unpickler._source = (memoryview(s).cast('B'), file)
+    return unpickler.load()
 
 # Use the faster _pickle if possible
 try:
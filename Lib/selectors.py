@@ -6,6 +6,7 @@
 
 
 from abc import ABCMeta, abstractmethod
+from array import array
 from collections import namedtuple
 from collections.abc import Mapping
 import math
@@ -446,6 +447,24 @@ class EpollSelector(_PollLikeSelector):
         _EVENT_READ = select.EPOLLIN
         _EVENT_WRITE = select.EPOLLOUT
 
+        def __init__(self):
+            super().__init__()
+            # (fd, events) pairs filled in by epoll.poll_into(), reused
+            # across calls to select() and grown as descriptors are
+            # registered.  It always has room for at least one event, since
+            # epoll_wait() expects `maxevents` to be greater than zero and
+            # we want `select()` to be callable when no FD is registered.
+            self._events = array('i', (0, 0))
+            self._events_view = memoryview(self._events)
+
+        def register(self, fileobj, events, data=None):
+            key = super().register(fileobj, events, data)
+            if 2 * len(self._fd_to_key) > len(self._events):
+                self._events_view.release()
+                self._events = array('i', bytes(16 * len(self._fd_to_key)))
+                self._events_view = memoryview(self._events)
+            return key
+
         def fileno(self):
             return self._selector.fileno()
 
@@ -459,24 +478,23 @@ def select(self, timeout=None):
                 # from zero to wait *at least* timeout seconds.
                 timeout = math.ceil(timeout * 1e3) * 1e-3
 
-            # epoll_wait() expects `maxevents` to be greater than zero;
-            # we want to make sure that `select()` can be called when no
-            # FD is registered.
-            max_ev = max(len(self._fd_to_key), 1)
-
             ready = []
             try:
-                fd_event_list = self._selector.poll(timeout, max_ev)
+                nfds = self._selector.poll_into(self._events, timeout)
             except InterruptedError:
                 return ready
-            for fd, event in fd_event_list:
+            if not nfds:
+                return ready
+            fd_to_key = self._fd_to_key
+            it = iter(self._events_view[:2 * nfds])
+            for fd, event in zip(it, it):
                 events = 0
                 if event & ~select.EPOLLIN:
                     events |= EVENT_WRITE
                 if event & ~select.EPOLLOUT:
                     events |= EVENT_READ
 
-                key = self._key_from_fd(fd)
+                key = fd_to_key.get(fd)
                 if key:
                     ready.append((key, events & key.events))
             return ready
@@ -1163,6 +1163,20 @@ def compression(self):
         else:
             return self._sslobj.compression()
 
+    def uses_ktls_for_send(self):
+        self._checkClosed()
+        if self._sslobj is None:
+            return False
+        else:
+            return self._sslobj.uses_ktls_for_send()
+
+    def uses_ktls_for_recv(self):
+        self._checkClosed()
+        if self._sslobj is None:
+            return False
+        else:
+            return self._sslobj.uses_ktls_for_recv()
+
     def send(self, data, flags=0):
         self._checkClosed()
         if self._sslobj is not None:
@@ -1208,12 +1222,14 @@ def sendall(self, data, flags=0):
 
     def sendfile(self, file, offset=0, count=None):
         """Send a file, possibly by using os.sendfile() if this is a
-        clear-text socket.  Return the total number of bytes sent.
+        clear-text socket or kernel TLS is in use for sending.  Return the
+        total number of bytes sent.
         """
-        if self._sslobj is not None:
+        if self._sslobj is not None and not self._sslobj.uses_ktls_for_send():
             return self._sendfile_use_send(file, offset, count)
         else:
-            # os.sendfile() works with plain sockets only
+            # os.sendfile() works with plain sockets, and with TLS sockets
+            # once the kernel encrypts outgoing records
             return super().sendfile(file, offset, count)
 
     def recv(self, buflen=1024, flags=0):
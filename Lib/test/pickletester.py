@@ -3403,6 +3403,35 @@ def loads(data, **kwargs):
 
         self.check_dumps_loads_oob_buffers(dumps, loads)
 
+    def test_loads_zero_copy(self):
+        # In-band bytearray payloads (PEP 574) can be returned as views
+        # of the pickle data
+        payload = bytearray(b'abcd' * 100000)
+        obj = [pickle.PickleBuffer(payload), b'small', bytearray(b'xy')]
+        for proto in range(5, pickle.HIGHEST_PROTOCOL + 1):
+            data = self.dumps(obj, protocol=proto)
+            new = self.loads(data)
+            self.assertIs(type(new[0]), bytearray)
+            self.assertIs(type(new[2]), bytearray)
+            for source in (data, bytearray(data), memoryview(data).cast('c')):
+                with self.subTest(proto=proto, source=type(source)):
+                    new = self.loads(source, zero_copy=True)
+                    self.assertIsInstance(new[0], memoryview)
+                    self.assertIs(new[0].obj, source.obj
+                                  if isinstance(source, memoryview) else source)
+                    self.assertEqual(new[0].format, 'B')
+                    self.assertEqual(new[0].readonly,
+                                     not isinstance(source, bytearray))
+                    self.assertEqual(new[0], payload)
+                    self.assertEqual(new[1], b'small')
+                    # Protocol 5 pickles plain bytearrays like PickleBuffers.
+                    self.assertIsInstance(new[2], memoryview)
+                    if not isinstance(source, bytearray):
+                        self.assertTrue(new[2].readonly)
+                    self.assertEqual(new[2], b'xy')
+            with self.assertRaises(pickle.UnpicklingError):
+                self.loads(data[:1000], zero_copy=True)
+
 
 class AbstractPersistentPicklerTests(unittest.TestCase):
 
@@ -2,7 +2,7 @@
 Common tests shared by test_unicode, test_userstring and test_bytes.
 """
 
-import unittest, string, sys, struct
+import unittest, string, sys, struct, random
 from test import support
 from collections import UserList
 
@@ -213,6 +213,45 @@ def test_find(self):
                 if loc != -1:
                     self.assertEqual(i[loc:loc+len(j)], j)
 
+    def test_find_long_needles(self):
+        # Long needles in long haystacks are searched for with the two-way
+        # algorithm; compare against a brute force search.
+        def reference_find(p, s):
+            for i in range(len(s) - len(p) + 1):
+                if s[i:i + len(p)] == p:
+                    return i
+            return -1
+
+        rr = random.randrange
+        choices = random.choices
+        for _ in range(30):
+            p = ''.join(choices('abc', k=rr(6, 120)))
+            if rr(2):
+                # Periodic needles exercise a different code path.
+                p = (p[:rr(1, 6)] * len(p))[:len(p)]
+            s = ''.join(choices('abc', k=rr(3000, 4000)))
+            for _ in range(rr(3)):
+                i = rr(len(s) - len(p))
+                s = s[:i] + p + s[i + len(p):]
+            p = self.fixtype(p)
+            s = self.fixtype(s)
+            self.assertEqual(s.find(p), reference_find(p, s))
+            self.assertEqual(p in s, reference_find(p, s) != -1)
+
+    def test_find_pathological(self):
+        # These take quadratic time with a naive or Horspool search.
+        for n in (3000, 100000):
+            s = self.fixtype('a' * n)
+            p = self.fixtype('a' * 500 + 'b' + 'a' * 500)
+            self.checkequal(-1, s, 'find', p)
+            self.checkequal(0, s, 'count', p)
+            self.checkequal(n, s + p, 'find', p)
+            self.checkequal(2, s + p + s + p, 'count', p)
+            p = self.fixtype('a' * 50 + 'b')
+            self.checkequal(-1, s, 'find', p)
+            self.checkequal(n, s + p, 'find', p)
+            self.checkequal(2, s + p + s + p, 'count', p)
+
     def test_rfind(self):
         self.checkequal(9,  'abcdefghiabc', 'rfind', 'abc')
         self.checkequal(12, 'abcdefghiabc', 'rfind', '')
@@ -266,6 +305,43 @@ def test_rfind(self):
         # issue #15534
         self.checkequal(0, '<......\u043c...', "rfind", "<")
 
+    def test_rfind_long_needles(self):
+        # Long needles in long haystacks are searched for backwards with
+        # the two-way algorithm; compare against a brute force search.
+        def reference_rfind(p, s):
+            for i in range(len(s) - len(p), -1, -1):
+                if s[i:i + len(p)] == p:
+                    return i
+            return -1
+
+        rr = random.randrange
+        choices = random.choices
+        for _ in range(30):
+            p = ''.join(choices('abc', k=rr(6, 200)))
+            if rr(2):
+                # Periodic needles exercise a different code path.
+                p = (p[:rr(1, 6)] * len(p))[:len(p)]
+            s = ''.join(choices('abc', k=rr(3000, 4000)))
+            for _ in range(rr(3)):
+                i = rr(len(s) - len(p))
+                s = s[:i] + p + s[i + len(p):]
+            p = self.fixtype(p)
+            s = self.fixtype(s)
+            self.assertEqual(s.rfind(p), reference_rfind(p, s))
+
+    def test_rfind_pathological(self):
+        # These take quadratic time with a naive or Horspool search.
+        for n in (3000, 100000):
+            s = self.fixtype('a' * n)
+            p = self.fixtype('a' * 500 + 'b' + 'a' * 500)
+            self.checkequal(-1, s, 'rfind', p)
+            self.checkequal(0, p + s, 'rfind', p)
+            self.checkequal(len(p) + n, p + s + p + s, 'rfind', p)
+            p = self.fixtype('ab' + 'a' * 50)
+            self.checkequal(-1, s, 'rfind', p)
+            self.checkequal(0, p + s, 'rfind', p)
+            self.checkequal(len(p) + n, p + s + p + s, 'rfind', p)
+
     def test_index(self):
         self.checkequal(0, 'abcdefghiabc', 'index', '')
         self.checkequal(3, 'abcdefghiabc', 'index', 'def')
@@ -321,11 +397,19 @@ def test_lower(self):
         self.checkequal('hello', 'HeLLo', 'lower')
         self.checkequal('hello', 'hello', 'lower')
         self.checkraises(TypeError, 'hello', 'lower', 42)
+        # The ASCII case is converted several bytes at once; check the
+        # characters around the letter ranges and some alignments.
+        for p in range(8):
+            self.checkequal(' '*p + '@az[`az{' + 'az'*8, ' '*p + '@AZ[`az{' + 'AZ'*8,
+                            'lower')
 
     def test_upper(self):
         self.checkequal('HELLO', 'HeLLo', 'upper')
         self.checkequal('HELLO', 'HELLO', 'upper')
         self.checkraises(TypeError, 'hello', 'upper', 42)
+        for p in range(8):
+            self.checkequal(' '*p + '@AZ[`AZ{' + 'AZ'*8, ' '*p + '@AZ[`az{' + 'az'*8,
+                            'upper')
 
     def test_expandtabs(self):
         self.checkequal('abc\rab      def\ng       hi', 'abc\rab\tdef\ng\thi',
@@ -924,6 +1008,12 @@ def test_isspace(self):
         self.checkequal(True, ' \t\r\n', 'isspace')
         self.checkequal(False, ' \t\r\na', 'isspace')
         self.checkraises(TypeError, 'abc', 'isspace', 42)
+        for p in range(8):
+            self.checkequal(True, ' '*p + '\t\n\x0b\x0c\r' + ' '*8, 'isspace')
+            self.checkequal(False, ' '*p + '\x08' + ' '*8, 'isspace')
+            self.checkequal(False, ' '*p + '\x0e' + ' '*8, 'isspace')
+            if self.contains_bytes:
+                self.checkequal(False, ' '*p + '\x89' + ' '*8, 'isspace')
 
     def test_isalpha(self):
         self.checkequal(False, '', 'isalpha')
@@ -934,6 +1024,12 @@ def test_isalpha(self):
         self.checkequal(False, 'aBc123', 'isalpha')
         self.checkequal(False, 'abc\n', 'isalpha')
         self.checkraises(TypeError, 'abc', 'isalpha', 42)
+        for p in range(8):
+            self.checkequal(True, 'a'*p + 'azAZ' + 'b'*8, 'isalpha')
+            for c in '@[`{':
+                self.checkequal(False, 'a'*p + c + 'b'*8, 'isalpha')
+            if self.contains_bytes:
+                self.checkequal(False, 'a'*p + '\xc1' + 'b'*8, 'isalpha')
 
     def test_isalnum(self):
         self.checkequal(False, '', 'isalnum')
@@ -945,6 +1041,10 @@ def test_isalnum(self):
         self.checkequal(False, 'aBc000 ', 'isalnum')
         self.checkequal(False, 'abc\n', 'isalnum')
         self.checkraises(TypeError, 'abc', 'isalnum', 42)
+        for p in range(8):
+            self.checkequal(True, 'a'*p + 'azAZ09' + '1'*8, 'isalnum')
+            for c in '/:@[`{':
+                self.checkequal(False, 'a'*p + c + '1'*8, 'isalnum')
 
     def test_isascii(self):
         self.checkequal(True, '', 'isascii')
@@ -967,6 +1067,12 @@ def test_isdigit(self):
         self.checkequal(True, '0', 'isdigit')
         self.checkequal(True, '0123456789', 'isdigit')
         self.checkequal(False, '0123456789a', 'isdigit')
+        for p in range(8):
+            self.checkequal(True, '0'*p + '09' + '1'*8, 'isdigit')
+            for c in '/:':
+                self.checkequal(False, '0'*p + c + '1'*8, 'isdigit')
+            if self.contains_bytes:
+                self.checkequal(False, '0'*p + '\xb1' + '1'*8, 'isdigit')
 
         self.checkraises(TypeError, 'abc', 'isdigit', 42)
 
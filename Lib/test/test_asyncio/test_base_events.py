@@ -13,6 +13,7 @@
 import asyncio
 from asyncio import base_events
 from asyncio import constants
+from asyncio import events
 from test.test_asyncio import utils as test_utils
 from test import support
 from test.support.script_helper import assert_python_ok
@@ -150,9 +151,11 @@ def test_ipaddr_info_no_inet_pton(self, m_socket):
 
 class BaseEventLoopTests(test_utils.TestCase):
 
+    loop_class = base_events.BaseEventLoop
+
     def setUp(self):
         super().setUp()
-        self.loop = base_events.BaseEventLoop()
+        self.loop = self.loop_class()
         self.loop._selector = mock.Mock()
         self.loop._selector.select.return_value = ()
         self.set_event_loop(self.loop)
@@ -472,6 +475,66 @@ def cb():
         # Ensure only uncancelled events remain scheduled
         self.assertTrue(all([not x._cancelled for x in self.loop._scheduled]))
 
+    def test__run_once_python_handles(self):
+        calls = []
+        now = self.loop.time()
+        h1 = events._PyTimerHandle(now - 1, calls.append, ('h1',),
+                                   self.loop, None)
+        h2 = events._PyTimerHandle(now - 2, calls.append, ('h2',),
+                                   self.loop, None)
+        h3 = events._PyTimerHandle(now + 10, calls.append, ('h3',),
+                                   self.loop, None)
+        h4 = events._PyHandle(calls.append, ('h4',), self.loop, None)
+        h5 = events._PyHandle(calls.append, ('h5',), self.loop, None)
+        h5.cancel()
+        for h in (h2, h1, h3):
+            h._scheduled = True
+            self.loop._scheduled.append(h)
+        self.loop._ready.extend([h4, h5])
+
+        self.loop._process_events = mock.Mock()
+        self.loop._run_once()
+
+        self.assertEqual(calls, ['h4', 'h2', 'h1'])
+        self.assertFalse(h1._scheduled)
+        self.assertFalse(h2._scheduled)
+        self.assertTrue(h3._scheduled)
+        self.assertEqual(self.loop._scheduled, [h3])
+        self.assertFalse(self.loop._ready)
+
+    def test__run_once_debug_current_handle(self):
+        current = []
+
+        def cb():
+            current.append(self.loop._current_handle)
+
+        def interrupt():
+            raise KeyboardInterrupt
+
+        self.loop.set_debug(True)
+        self.loop._process_events = mock.Mock()
+        h = self.loop.call_soon(cb)
+        self.loop._run_once()
+        self.assertEqual(current, [h])
+        self.assertIsNone(self.loop._current_handle)
+
+        self.loop.call_soon(interrupt)
+        with self.assertRaises(KeyboardInterrupt):
+            self.loop._run_once()
+        self.assertIsNone(self.loop._current_handle)
+
+    def test_call_soon_bad_arguments(self):
+        with self.assertRaises(TypeError):
+            self.loop.call_soon()
+        with self.assertRaises(TypeError):
+            self.loop.call_soon(lambda: None, delay=1)
+        self.assertFalse(self.loop._ready)
+
+    def test_call_soon_closed(self):
+        self.loop.close()
+        with self.assertRaisesRegex(RuntimeError, 'Event loop is closed'):
+            self.loop.call_soon(lambda: None)
+
     def test_run_until_complete_type_error(self):
         self.assertRaises(TypeError,
             self.loop.run_until_complete, 'blah')
@@ -994,6 +1057,35 @@ def test_asyncgen_finalization_by_gc_in_other_thread(self):
             self.assertTrue(status['finalized'])
 
 
+class _PyBaseEventLoop(base_events.BaseEventLoop):
+    call_soon = base_events._py_call_soon
+    _call_soon = base_events._py__call_soon
+    _run_once = base_events._py__run_once
+
+
+class PyBaseEventLoopTests(BaseEventLoopTests):
+    """Run BaseEventLoopTests against the pure-Python scheduler."""
+
+    loop_class = _PyBaseEventLoop
+
+
+@unittest.skipUnless(hasattr(base_events, '_c__run_once'),
+                     'requires the C _asyncio module')
+class CBaseEventLoopTests(test_utils.TestCase):
+
+    def test_c_methods_installed(self):
+        cls = base_events.BaseEventLoop
+        self.assertIs(cls.__dict__['call_soon'], base_events._c_call_soon)
+        self.assertIs(cls.__dict__['_call_soon'], base_events._c__call_soon)
+        self.assertIs(cls.__dict__['_run_once'], base_events._c__run_once)
+
+    def test_c_methods_check_self(self):
+        with self.assertRaises(TypeError):
+            base_events._c__run_once(object())
+        with self.assertRaises(TypeError):
+            base_events._c_call_soon(object(), lambda: None)
+
+
 class MyProto(asyncio.Protocol):
     done = None
 
@@ -1,7 +1,9 @@
 """Tests for selector_events.py"""
 
+import errno
 import selectors
 import socket
+import sys
 import unittest
 from unittest import mock
 try:
@@ -890,6 +892,127 @@ def test_transport_close_remove_writer(self, m_log):
         transport.close()
         remove_writer.assert_called_with(self.sock_fd)
 
+    def zerocopy_transport(self):
+        self.sock.family = socket.AF_INET
+        self.sock.getsockopt.return_value = 1
+        transport = self.socket_transport()
+        self.assertTrue(transport._zerocopy)
+        return transport
+
+    @unittest.skipUnless(hasattr(socket.socket, 'zerocopy_completions'),
+                         'requires socket.zerocopy_completions()')
+    def test_write_zerocopy(self):
+        transport = self.zerocopy_transport()
+        data = b'x' * transport._zerocopy_threshold
+        self.sock.send.return_value = len(data)
+        transport.write(data)
+        self.sock.send.assert_called_with(data, socket.MSG_ZEROCOPY)
+        self.assertEqual(transport._zerocopy_pending, 1)
+
+        # Small writes and mutable buffers are copied.
+        for data in (b'x', bytearray(data), memoryview(data)):
+            self.sock.send.return_value = len(data)
+            transport.write(data)
+            self.sock.send.assert_called_with(data)
+        self.assertEqual(transport._zerocopy_pending, 1)
+
+    @unittest.skipUnless(hasattr(socket.socket, 'zerocopy_completions'),
+                         'requires socket.zerocopy_completions()')
+    def test_read_ready_zerocopy_completions(self):
+        transport = self.zerocopy_transport()
+        transport._zerocopy_pending = 3
+        self.sock.recv.return_value = b'data'
+
+        self.sock.zerocopy_completions.return_value = [(0, 1, False)]
+        transport._read_ready()
+        self.assertEqual(transport._zerocopy_pending, 1)
+        self.assertTrue(transport._zerocopy)
+
+        # The kernel copied the data: stop using MSG_ZEROCOPY.
+        self.sock.zerocopy_completions.return_value = [(2, 2, True)]
+        transport._read_ready()
+        self.assertEqual(transport._zerocopy_pending, 0)
+        self.assertFalse(transport._zerocopy)
+
+        transport._read_ready()
+        self.assertEqual(self.sock.zerocopy_completions.call_count, 2)
+        self.assertEqual(self.protocol.data_received.call_count, 3)
+
+    @unittest.skipUnless(hasattr(socket.socket, 'zerocopy_completions'),
+                         'requires socket.zerocopy_completions()')
+    def test_close_waits_zerocopy_completions(self):
+        transport = self.zerocopy_transport()
+        transport._zerocopy_pending = 1
+        self.sock.zerocopy_completions.return_value = []
+        self.loop.call_later = mock.Mock()
+        transport.close()
+        test_utils.run_briefly(self.loop)
+        self.loop.call_later.assert_called_with(
+            transport._zerocopy_close_delay,
+            transport._call_connection_lost, None)
+        self.assertFalse(self.protocol.connection_lost.called)
+        self.assertFalse(self.sock.close.called)
+
+        self.sock.zerocopy_completions.return_value = [(0, 0, False)]
+        transport._call_connection_lost(None)
+        self.protocol.connection_lost.assert_called_with(None)
+        self.assertTrue(self.sock.close.called)
+
+    @unittest.skipUnless(hasattr(socket.socket, 'zerocopy_completions'),
+                         'requires socket.zerocopy_completions()')
+    def test_write_zerocopy_real_socket(self):
+        data = [bytes([i]) * 256 * 1024 for i in range(4)]
+
+        async def main():
+            loop = asyncio.get_running_loop()
+            received = bytearray()
+            lost = loop.create_future()
+
+            class Receiver(asyncio.Protocol):
+                def data_received(self, data):
+                    received.extend(data)
+
+                def connection_lost(self, exc):
+                    lost.set_result(exc)
+
+            server = await loop.create_server(Receiver, '127.0.0.1', 0)
+            with socket.create_connection(
+                    server.sockets[0].getsockname()) as sock:
+                try:
+                    sock.setsockopt(socket.SOL_SOCKET, socket.SO_ZEROCOPY, 1)
+                except OSError as e:
+                    self.skipTest(f"SO_ZEROCOPY not supported: {e}")
+                sock.setblocking(False)
+                transport, _ = await loop.create_connection(
+                    asyncio.Protocol, sock=sock)
+                self.assertTrue(transport._zerocopy)
+                for chunk in data:
+                    transport.write(chunk)
+                transport.close()
+                self.assertIsNone(await lost)
+                self.assertEqual(transport._zerocopy_pending, 0)
+            server.close()
+            await server.wait_closed()
+            return received
+
+        loop = asyncio.SelectorEventLoop()
+        try:
+            received = loop.run_until_complete(main())
+        finally:
+            loop.close()
+        self.assertEqual(received, b''.join(data))
+
+    @unittest.skipUnless(hasattr(socket.socket, 'zerocopy_completions'),
+                         'requires socket.zerocopy_completions()')
+    def test_abort_zerocopy_pending(self):
+        transport = self.zerocopy_transport()
+        transport._zerocopy_pending = 1
+        self.sock.zerocopy_completions.return_value = []
+        transport.abort()
+        test_utils.run_briefly(self.loop)
+        self.protocol.connection_lost.assert_called_with(None)
+        self.assertTrue(self.sock.close.called)
+
 
 class SelectorSocketTransportBufferedProtocolTests(test_utils.TestCase):
 
@@ -1096,6 +1219,172 @@ def test_read_ready(self):
         self.protocol.datagram_received.assert_called_with(
             b'data', ('0.0.0.0', 1234))
 
+    @unittest.skipUnless(hasattr(socket.socket, 'recvmmsg_into'),
+                         'requires socket.recvmmsg_into()')
+    def test_read_ready_batch(self):
+        self.sock.family = socket.AF_INET
+        transport = self.datagram_transport()
+        transport._recv_batch_threshold = 2
+        transport._recv_batch_countdown = 2
+        transport._recv_batch_size = 3
+        transport._recv_batch_bufsize = 4
+
+        self.sock.recvfrom.return_value = (b'data', ('0.0.0.0', 1234))
+        transport._read_ready()
+        self.assertIsNone(transport._recv_bufs)
+        self.sock.recvfrom.return_value = (b'datagram!', ('0.0.0.0', 1234))
+        transport._read_ready()
+        # Large enough for the largest datagram received so far.
+        self.assertEqual([len(buf) for buf in transport._recv_bufs],
+                         [16, 16, 16])
+        self.assertEqual(self.sock.recvfrom.call_count, 2)
+
+        def recvmmsg_into(bufs, flags):
+            bufs[0][:3] = b'abc'
+            bufs[1][:2] = b'de'
+            return [(3, ('0.0.0.0', 1), 0), (2, ('0.0.0.0', 2), 0)]
+
+        self.sock.recvmmsg_into.side_effect = recvmmsg_into
+        self.protocol.datagram_received.reset_mock()
+        transport._read_ready()
+
+        self.assertEqual(self.sock.recvfrom.call_count, 2)
+        self.assertEqual(self.protocol.datagram_received.call_args_list,
+                         [mock.call(b'abc', ('0.0.0.0', 1)),
+                          mock.call(b'de', ('0.0.0.0', 2))])
+        self.assertIsNotNone(transport._recv_bufs)
+
+        # A single datagram per readiness event: the buffers are released.
+        self.sock.recvmmsg_into.side_effect = None
+        self.sock.recvmmsg_into.return_value = [(0, ('0.0.0.0', 3), 0)]
+        self.protocol.datagram_received.reset_mock()
+        transport._read_ready()
+        self.protocol.datagram_received.assert_called_once_with(
+            b'', ('0.0.0.0', 3))
+        self.assertIsNone(transport._recv_bufs)
+        self.assertEqual(transport._recv_batch_countdown, 2)
+        transport._read_ready()
+        self.assertEqual(self.sock.recvfrom.call_count, 3)
+
+    @unittest.skipUnless(hasattr(socket.socket, 'recvmmsg_into'),
+                         'requires socket.recvmmsg_into()')
+    def test_read_ready_batch_truncated(self):
+        self.sock.family = socket.AF_INET
+        transport = self.datagram_transport()
+        transport._recv_batch_countdown = None
+        transport._recv_bufs = [memoryview(bytearray(4)) for _ in range(3)]
+
+        def recvmmsg_into(bufs, flags):
+            bufs[0][:2] = b'ab'
+            bufs[1][:4] = b'cdef'
+            bufs[2][:1] = b'g'
+            return [(2, ('0.0.0.0', 1), 0),
+                    (4, ('0.0.0.0', 2), socket.MSG_TRUNC),
+                    (1, ('0.0.0.0', 3), 0)]
+
+        self.sock.recvmmsg_into.side_effect = recvmmsg_into
+        transport._read_ready()
+        self.assertEqual(self.protocol.datagram_received.call_args_list,
+                         [mock.call(b'ab', ('0.0.0.0', 1)),
+                          mock.call(b'g', ('0.0.0.0', 3))])
+        err = self.protocol.error_received.call_args.args[0]
+        self.assertIsInstance(err, OSError)
+        self.assertEqual(err.errno, errno.EMSGSIZE)
+        # Back to recvfrom(); the next batch gets larger buffers.
+        self.assertIsNone(transport._recv_bufs)
+        self.assertEqual(transport._recv_batch_countdown,
+                         transport._recv_batch_threshold)
+        self.assertEqual(transport._recv_max_nbytes, 5)
+
+    @unittest.skipUnless(hasattr(socket.socket, 'recvmmsg_into'),
+                         'requires socket.recvmmsg_into()')
+    def test_read_ready_batch_real_socket(self):
+        # The batched and unbatched paths deliver the same datagrams and
+        # addresses.
+        def receive(batch):
+            with socket.socket(socket.AF_INET, socket.SOCK_DGRAM) as sock, \
+                 socket.socket(socket.AF_INET, socket.SOCK_DGRAM) as s1, \
+                 socket.socket(socket.AF_INET, socket.SOCK_DGRAM) as s2:
+                sock.bind(('127.0.0.1', 0))
+                sock.setblocking(False)
+                s1.bind(('127.0.0.1', 0))
+                s2.bind(('127.0.0.1', 0))
+                protocol = test_utils.make_test_protocol(
+                    asyncio.DatagramProtocol)
+                transport = _SelectorDatagramTransport(self.loop, sock,
+                                                       protocol)
+                transport._recv_batch_countdown = 1 if batch else None
+                sent = []
+                # The first datagram, received with recvfrom(), sizes
+                # the batch buffers.
+                sizes = [9000, 0, 1, 100, 1500, 9000, 3, 200]
+                for i, size in enumerate(sizes):
+                    sender = (s1, s2)[i % 2]
+                    data = bytes([i]) * size
+                    sender.sendto(data, sock.getsockname())
+                    sent.append((data, sender.getsockname()))
+                with mock.patch.object(
+                        transport, '_read_ready__batch',
+                        wraps=transport._read_ready__batch) as read_batch:
+                    for _ in sent:
+                        transport._read_ready()
+                self.assertEqual(read_batch.called, batch)
+                close_transport(transport)
+                received = [c.args for c in
+                            protocol.datagram_received.call_args_list]
+                self.assertEqual(received, sent)
+                return [data for data, addr in received]
+
+        self.assertEqual(receive(batch=True), receive(batch=False))
+
+    @unittest.skipUnless(hasattr(socket.socket, 'recvmmsg_into'),
+                         'requires socket.recvmmsg_into()')
+    def test_read_ready_batch_truncated_real_socket(self):
+        with socket.socket(socket.AF_INET, socket.SOCK_DGRAM) as sock, \
+             socket.socket(socket.AF_INET, socket.SOCK_DGRAM) as sender:
+            sock.bind(('127.0.0.1', 0))
+            sock.setblocking(False)
+            protocol = test_utils.make_test_protocol(asyncio.DatagramProtocol)
+            transport = _SelectorDatagramTransport(self.loop, sock, protocol)
+            transport._recv_batch_countdown = 1
+            for data in (b'x', b'y' * 10000, b'z' * 100):
+                sender.sendto(data, sock.getsockname())
+            for _ in range(3):
+                transport._read_ready()
+            self.assertEqual(len(protocol.datagram_received.call_args_list),
+                             2)
+            self.assertEqual(protocol.datagram_received.call_args_list[1]
+                             .args[0], b'z' * 100)
+            err = protocol.error_received.call_args.args[0]
+            self.assertEqual(err.errno, errno.EMSGSIZE)
+            # The next batch is large enough for the lost datagram.
+            self.assertIsNone(transport._recv_bufs)
+            transport._recv_batch_countdown = 1
+            sender.sendto(b'w', sock.getsockname())
+            transport._read_ready()
+            self.assertGreater(len(transport._recv_bufs[0]), 2048)
+            if sys.platform == 'linux':
+                # The size of the truncated datagram is known.
+                self.assertEqual(len(transport._recv_bufs[0]), 16384)
+            close_transport(transport)
+
+    @unittest.skipUnless(hasattr(socket.socket, 'recvmmsg_into'),
+                         'requires socket.recvmmsg_into()')
+    def test_read_ready_batch_err(self):
+        self.sock.family = socket.AF_INET
+        transport = self.datagram_transport()
+        transport._recv_bufs = [memoryview(bytearray(8))]
+
+        err = self.sock.recvmmsg_into.side_effect = OSError()
+        transport._read_ready()
+        self.protocol.error_received.assert_called_with(err)
+
+        self.sock.recvmmsg_into.side_effect = BlockingIOError
+        transport._fatal_error = mock.Mock()
+        transport._read_ready()
+        self.assertFalse(transport._fatal_error.called)
+        self.assertFalse(self.protocol.datagram_received.called)
+
     def test_read_ready_tryagain(self):
         transport = self.datagram_transport()
 
@@ -2047,6 +2047,88 @@ async def coro2(loop):
         self.loop.run_until_complete(asyncio.wait((task1, task2)))
         self.assertIsNone(asyncio.current_task(loop=self.loop))
 
+    def test_eager_start_completes_synchronously(self):
+        events = []
+
+        async def child():
+            events.append('child')
+            return 42
+
+        async def main():
+            t = self.Task(child(), loop=self.loop, eager_start=True)
+            events.append('created')
+            self.assertTrue(t.done())
+            self.assertIs(asyncio.current_task(), outer)
+            return t.result()
+
+        outer = self.new_task(self.loop, main())
+        self.assertEqual(self.loop.run_until_complete(outer), 42)
+        self.assertEqual(events, ['child', 'created'])
+        self.assertIsNone(asyncio.current_task(loop=self.loop))
+
+    def test_eager_start_suspends(self):
+        fut = self.new_future(self.loop)
+        current = []
+
+        async def child():
+            current.append(asyncio.current_task())
+            res = await fut
+            current.append(asyncio.current_task())
+            return res
+
+        async def main():
+            t = self.Task(child(), loop=self.loop, eager_start=True)
+            self.assertFalse(t.done())
+            self.assertEqual(current, [t])
+            self.assertIs(asyncio.current_task(), outer)
+            self.assertIn(t, asyncio.all_tasks())
+            fut.set_result('spam')
+            self.assertEqual(await t, 'spam')
+            self.assertEqual(current, [t, t])
+
+        outer = self.new_task(self.loop, main())
+        self.loop.run_until_complete(outer)
+
+    def test_eager_start_exception(self):
+        async def child():
+            raise ValueError('boom')
+
+        async def main():
+            t = self.Task(child(), loop=self.loop, eager_start=True)
+            self.assertTrue(t.done())
+            with self.assertRaises(ValueError):
+                t.result()
+
+        self.loop.run_until_complete(self.new_task(self.loop, main()))
+
+    def test_eager_start_loop_not_running(self):
+        async def child():
+            return 1
+
+        t = self.Task(child(), loop=self.loop, eager_start=True)
+        self.assertFalse(t.done())
+        self.assertEqual(self.loop.run_until_complete(t), 1)
+
+    def test_eager_task_factory(self):
+        async def child(n):
+            if n % 2:
+                await asyncio.sleep(0)
+            return n
+
+        async def main():
+            tasks = [asyncio.create_task(child(n), name=f'child-{n}')
+                     for n in range(4)]
+            self.assertEqual([t.done() for t in tasks],
+                             [True, False, True, False])
+            self.assertEqual([t.get_name() for t in tasks],
+                             [f'child-{n}' for n in range(4)])
+            return await asyncio.gather(*tasks)
+
+        self.loop.set_task_factory(
+            asyncio.create_eager_task_factory(self.Task))
+        self.assertEqual(self.loop.run_until_complete(main()),
+                         [0, 1, 2, 3])
+
     # Some thorough tests for cancellation propagation through
     # coroutines, tasks and wait().
 
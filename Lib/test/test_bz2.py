@@ -250,6 +250,22 @@ def testWrite(self):
         with open(self.filename, 'rb') as f:
             self.assertEqual(ext_decompress(f.read()), self.TEXT)
 
+    def testWriteThreads(self):
+        text = self.TEXT * 1000
+        with BZ2File(self.filename, "w", compresslevel=1, threads=2) as bz2f:
+            bz2f.write(text)
+            bz2f.write(text)
+        with open(self.filename, 'rb') as f:
+            self.assertEqual(ext_decompress(f.read()), text * 2)
+        with BZ2File(self.filename) as bz2f:
+            self.assertEqual(bz2f.read(), text * 2)
+
+    def testThreadsBadArgs(self):
+        self.createTempFile()
+        self.assertRaises(ValueError, BZ2File, self.filename, threads=2)
+        self.assertRaises(ValueError, BZ2File, self.filename, "w",
+                          threads=-1)
+
     def testWriteChunks10(self):
         with BZ2File(self.filename, "w") as bz2f:
             n = 0
@@ -629,6 +645,14 @@ def testCompress(self):
         data += bz2c.flush()
         self.assertEqual(ext_decompress(data), self.TEXT)
 
+    def testCompressThreads(self):
+        text = self.TEXT * 5000
+        for threads in (0, 2):
+            with self.subTest(threads=threads):
+                data = bz2.compress(text, 1, threads=threads)
+                self.assertEqual(bz2.decompress(data), text)
+        self.assertEqual(bz2.decompress(bz2.compress(b'', threads=2)), b'')
+
     def testCompressEmptyString(self):
         bz2c = BZ2Compressor()
         data = bz2c.compress(b'')
@@ -354,6 +354,20 @@ def test_read_bigfield(self):
         finally:
             csv.field_size_limit(limit)
 
+    def test_read_bigfield_multiline(self):
+        # The field size limit applies to the whole field, even when
+        # it spans several lines.
+        limit = csv.field_size_limit()
+        try:
+            lines = ['"' + 'X' * 30 + '\n', 'Y' * 30 + '",Z']
+            expected = [['X' * 30 + '\n' + 'Y' * 30, 'Z']]
+            csv.field_size_limit(61)
+            self._read_test(lines, expected)
+            csv.field_size_limit(60)
+            self.assertRaises(csv.Error, self._read_test, lines, [])
+        finally:
+            csv.field_size_limit(limit)
+
     def test_read_linenum(self):
         r = csv.reader(['line,1', 'line,2', 'line,3'])
         self.assertEqual(r.line_num, 0)
@@ -21,6 +21,7 @@
 """
 Tests for epoll wrapper.
 """
+import array
 import errno
 import os
 import select
@@ -206,6 +207,50 @@ def test_control_and_wait(self):
         expected = [(server.fileno(), select.EPOLLOUT)]
         self.assertEqual(events, expected)
 
+    def test_poll_into(self):
+        client, server = self._connected_pair()
+        ep = select.epoll(16)
+        self.addCleanup(ep.close)
+        ep.register(server.fileno(), select.EPOLLIN | select.EPOLLOUT)
+        ep.register(client.fileno(), select.EPOLLIN | select.EPOLLOUT)
+
+        buf = array.array('i', [-1] * 8)
+        self.assertEqual(ep.poll_into(buf, 1), 2)
+        expected = [(client.fileno(), select.EPOLLOUT),
+                    (server.fileno(), select.EPOLLOUT)]
+        self.assertEqual(sorted(zip(buf[0:4:2], buf[1:4:2])), sorted(expected))
+        self.assertEqual(buf[4:], array.array('i', [-1] * 4))
+
+        client.sendall(b"Hello!")
+        server.sendall(b"world!!!")
+        time.sleep(0.01)
+        # Room for a single event
+        buf = array.array('i', [0, 0])
+        self.assertEqual(ep.poll_into(buf, timeout=1), 1)
+        self.assertIn(buf[0], (client.fileno(), server.fileno()))
+        self.assertEqual(buf[1], select.EPOLLIN | select.EPOLLOUT)
+
+        # Any writable buffer, even misaligned, is accepted
+        raw = bytearray(17)
+        self.assertEqual(ep.poll_into(memoryview(raw)[1:], 0), 2)
+        pairs = memoryview(raw)[1:].cast('i')
+        self.assertEqual(sorted(zip(pairs[0::2], pairs[1::2])),
+                         sorted((fd, select.EPOLLIN | select.EPOLLOUT)
+                                for fd, _ in expected))
+
+        ep.unregister(client.fileno())
+        ep.unregister(server.fileno())
+        self.assertEqual(ep.poll_into(buf, 0), 0)
+
+    def test_poll_into_errors(self):
+        ep = select.epoll()
+        self.addCleanup(ep.close)
+        self.assertRaises(ValueError, ep.poll_into, bytearray(7))
+        self.assertRaises(TypeError, ep.poll_into, b'x' * 8)
+        self.assertRaises(TypeError, ep.poll_into, bytearray(8), 'x')
+        ep.close()
+        self.assertRaises(ValueError, ep.poll_into, bytearray(8), 0)
+
     def test_errors(self):
         self.assertRaises(ValueError, select.epoll, -2)
         self.assertRaises(ValueError, select.epoll().register, -1,
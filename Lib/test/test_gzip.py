@@ -17,6 +17,7 @@
 from test.support.script_helper import assert_python_ok, assert_python_failure
 
 gzip = import_helper.import_module('gzip')
+zlib = import_helper.import_module('zlib')
 
 data1 = b"""  int length=DEFAULTALLOC, err = Z_OK;
   PyObject *RetVal;
@@ -553,6 +554,40 @@ def test_compress_mtime(self):
                         f.read(1) # to set mtime attribute
                         self.assertEqual(f.mtime, mtime)
 
+    def test_compress_threads(self):
+        data = (data1 + data2) * 10
+        for threads in (0, 2, 4):
+            with self.subTest(threads=threads):
+                datac = gzip.compress(data, threads=threads)
+                self.assertEqual(gzip.decompress(datac), data)
+                self.assertEqual(zlib.decompress(datac, 31), data)
+
+    def test_write_threads(self):
+        data = (data1 * 50 + data2 * 50) * 20
+        # Use small blocks so that several are compressed at once.
+        self.addCleanup(setattr, gzip._ThreadedDeflater, '_block_size',
+                        gzip._ThreadedDeflater._block_size)
+        gzip._ThreadedDeflater._block_size = 1000
+        with gzip.GzipFile(self.filename, 'wb', threads=2) as f:
+            f.write(data)
+            f.flush()
+            f.write(data)
+            f.flush(zlib.Z_FULL_FLUSH)
+            f.write(data)
+        with gzip.GzipFile(self.filename, 'rb') as f:
+            self.assertEqual(f.read(), data * 3)
+        with gzip.GzipFile(self.filename, 'wb', threads=3) as f:
+            pass
+        with gzip.GzipFile(self.filename, 'rb') as f:
+            self.assertEqual(f.read(), b'')
+
+    def test_threads_bad_args(self):
+        self.test_write()
+        with self.assertRaises(ValueError):
+            gzip.GzipFile(self.filename, 'rb', threads=2)
+        with self.assertRaises(ValueError):
+            gzip.compress(data1, threads=-1)
+
     def test_decompress(self):
         for data in (data1, data2):
             buf = io.BytesIO()
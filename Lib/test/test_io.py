@@ -26,6 +26,7 @@
 import os
 import pickle
 import random
+import re
 import signal
 import sys
 import sysconfig
@@ -1784,6 +1785,50 @@ def test_writelines_error(self):
         self.assertRaises(TypeError, bufio.writelines, None)
         self.assertRaises(TypeError, bufio.writelines, 'abc')
 
+    def test_writelines_large(self):
+        # Mix lines that fit in the buffer with lines larger than it,
+        # enough of them to need several vectored writes.
+        lines = []
+        for i in range(150):
+            lines.append(b'%d,' % i)
+            lines.append(bytes([65 + i % 26]) * (i % 7 + 8))
+            lines.append(bytearray(b'ab' * (i % 5)))
+            lines.append(memoryview(b'xyz' * (i % 3 + 3)))
+        expected = b''.join(lines)
+        self.addCleanup(os_helper.unlink, os_helper.TESTFN)
+        for container in (list, tuple, iter):
+            with self.open(os_helper.TESTFN, "w+b", buffering=0) as raw:
+                bufio = self.tp(raw, 8)
+                bufio.write(b'head')
+                bufio.writelines(container(lines))
+                self.assertEqual(bufio.tell(), len(expected) + 4)
+                bufio.write(b'tail')
+                bufio.flush()
+            with self.open(os_helper.TESTFN, "rb") as f:
+                self.assertEqual(f.read(), b'head' + expected + b'tail')
+
+    def test_writelines_overridden_write(self):
+        written = []
+        class MyWriter(self.tp):
+            def write(self, b):
+                written.append(bytes(b))
+                return super().write(b)
+        writer = self.MockRawIO()
+        bufio = MyWriter(writer, 8)
+        bufio.writelines([b'ab', b'cdefghijkl', b'm'])
+        bufio.flush()
+        self.assertEqual(written, [b'ab', b'cdefghijkl', b'm'])
+        self.assertEqual(b''.join(writer._write_stack), b'abcdefghijklm')
+
+    def test_writelines_closed(self):
+        writer = self.MockRawIO()
+        bufio = self.tp(writer, 8)
+        bufio.close()
+        self.assertRaises(ValueError, bufio.writelines, [b'abc'])
+        self.assertRaises(ValueError, bufio.writelines, [])
+        self.assertRaises(ValueError, bufio.writelines, iter([b'abc']))
+        self.assertRaises(ValueError, bufio.writelines, iter([]))
+
     def test_destructor(self):
         writer = self.MockRawIO()
         bufio = self.tp(writer, 8)
@@ -2194,6 +2239,32 @@ def test_read_and_write(self):
         self.assertEqual(b"ghjk", rw.read())
         self.assertEqual(b"dddeee", raw._write_stack[0])
 
+    def test_read_and_writelines(self):
+        # Large lines must be written at the logical position, not at the
+        # end of the read-ahead data; compare with the Python version.
+        def run(tp, ops):
+            self.addCleanup(os_helper.unlink, os_helper.TESTFN)
+            with self.open(os_helper.TESTFN, "wb") as f:
+                f.write(b"0123456789" * 5)
+            with self.open(os_helper.TESTFN, "r+b", buffering=0) as raw:
+                rw = tp(raw, 8)
+                results = [op(rw) for op in ops]
+                results.append(rw.tell())
+                rw.flush()
+            with self.open(os_helper.TESTFN, "rb") as f:
+                return results, f.read()
+        cases = [
+            [lambda f: f.read(1), lambda f: f.writelines([b"X" * 16])],
+            [lambda f: f.read(1), lambda f: f.write(b"ab"),
+             lambda f: f.writelines([b"Y" * 20, b"c", b"Z" * 9])],
+            [lambda f: f.write(b"abc"), lambda f: f.seek(1),
+             lambda f: f.writelines([b"W" * 12]), lambda f: f.read(3)],
+            [lambda f: f.read(3), lambda f: f.writelines((b"V" * 8,)),
+             lambda f: f.read(4)],
+        ]
+        for ops in cases:
+            self.assertEqual(run(self.tp, ops), run(pyio.BufferedRandom, ops))
+
     def test_seek_and_tell(self):
         raw = self.BytesIO(b"asdfghjkl")
         rw = self.tp(raw)
@@ -2848,6 +2919,58 @@ def test_newlines_input(self):
             txt.seek(0)
             self.assertEqual(txt.read(), "".join(expected))
 
+    def test_newlines_large_input(self):
+        # Enough lines to span several read chunks, and newline kinds first
+        # appearing past the first chunk.
+        lines = ["line %d %s" % (i, "x" * (i % 97)) for i in range(3000)]
+        def make(*seps):
+            return "".join(line + seps[i * len(seps) // len(lines)]
+                           for i, line in enumerate(lines))
+        for text in (make("\n"), make("\r\n"), make("\r"),
+                     make("\n", "\r"), make("\n", "\r\n"),
+                     make("\r\n", "\n", "\r", "\n")):
+            for newline, expected in [
+                (None, text.replace("\r\n", "\n").replace("\r", "\n")
+                           .splitlines(keepends=True)),
+                ("", text.splitlines(keepends=True)),
+                ]:
+                for encoding in ("latin-1", "utf-8", "utf-16"):
+                    data = text.encode(encoding)
+                    txt = self.TextIOWrapper(self.BytesIO(data),
+                                             encoding=encoding,
+                                             newline=newline)
+                    self.assertEqual(list(txt), expected)
+                    txt.seek(0)
+                    got = []
+                    while True:
+                        line = txt.readline()
+                        if not line:
+                            break
+                        got.append(line)
+                    self.assertEqual(got, expected)
+
+    def test_iteration_chunk_size(self):
+        # Iteration honours a changed _CHUNK_SIZE, so that small chunks
+        # exercise line endings split across reads.
+        sizes = []
+        class Reader(self.BytesIO):
+            def read1(self, size=-1):
+                sizes.append(size)
+                return super().read1(size)
+        text = "ab\r\ncd\ref\n\r\n" * 10 + "gh"
+        for newline in (None, "", "\n", "\r", "\r\n"):
+            with self.subTest(newline=newline):
+                sizes.clear()
+                txt = self.TextIOWrapper(Reader(text.encode("ascii")),
+                                         encoding="ascii", newline=newline)
+                txt._CHUNK_SIZE = 3
+                expected = self.TextIOWrapper(
+                    self.BytesIO(text.encode("ascii")), encoding="ascii",
+                    newline=newline).readlines()
+                self.assertEqual(list(txt), expected)
+                self.assertTrue(sizes)
+                self.assertLessEqual(max(sizes), 3)
+
     def test_newlines_output(self):
         testdict = {
             "": b"AAA\nBBB\nCCC\nX\rY\r\nZ",
@@ -3890,6 +4013,25 @@ def test_translate(self):
         decoder = self.IncrementalNewlineDecoder(decoder, translate=0)
         self.assertEqual(decoder.decode(b"\r\r\n"), "\r\r\n")
 
+    def test_decode_chunks(self):
+        for text in ("abc", "a\nb\nc", "a\r\nb\r\nc\r\n", "a\rb\rc",
+                     "a\nb\r\nc\rd\n", "\r\r\n\n\r", "a\x00\r\x00\nb"):
+            expected_newlines = set(re.findall("\r\n?|\n", text))
+            for translate in (False, True):
+                with self.subTest(text=text, translate=translate):
+                    decoder = self.IncrementalNewlineDecoder(None, translate)
+                    result = decoder.decode(text, final=True)
+                    if translate:
+                        self.assertEqual(
+                            result,
+                            text.replace("\r\n", "\n").replace("\r", "\n"))
+                    else:
+                        self.assertEqual(result, text)
+                    newlines = decoder.newlines
+                    if isinstance(newlines, str):
+                        newlines = (newlines,)
+                    self.assertEqual(set(newlines or ()), expected_newlines)
+
 class CIncrementalNewlineDecoderTest(IncrementalNewlineDecoderTest):
     pass
 
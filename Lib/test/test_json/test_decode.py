@@ -1,5 +1,6 @@
 import decimal
-from io import StringIO
+import itertools
+from io import BytesIO, StringIO
 from collections import OrderedDict
 from test.test_json import PyTest, CTest
 
@@ -95,5 +96,95 @@ def test_negative_index(self):
         d = self.json.JSONDecoder()
         self.assertRaises(ValueError, d.raw_decode, 'a'*42, -50000)
 
+    def test_iterload(self):
+        docs = [{'a': [1, 2.5]}, 'x\u20ac', 123, None, [], {},
+                {'nested': {'b': [True, False]}}]
+        text = '\n'.join(self.json.dumps(doc, ensure_ascii=False)
+                         for doc in docs) + '\n'
+        for chunk_size in (1, 2, 5, 64, 65536):
+            with self.subTest(chunk_size=chunk_size):
+                self.assertEqual(list(self.json.iterload(
+                    StringIO(text), chunk_size=chunk_size)), docs)
+                self.assertEqual(list(self.json.iterload(
+                    BytesIO(text.encode()), chunk_size=chunk_size)), docs)
+        # Documents need no separator unless they would run together.
+        self.assertEqual(list(self.json.iterload(StringIO('12 34[5]{}"6"'),
+                                                 chunk_size=1)),
+                         [12, 34, [5], {}, '6'])
+        self.assertEqual(list(self.json.iterload(
+            BytesIO(b'\xef\xbb\xbf{"a": 1}'), chunk_size=2)), [{'a': 1}])
+        self.assertEqual(list(self.json.iterload(StringIO(' \n '))), [])
+        self.assertEqual(list(self.json.iterload(
+            StringIO('{"a": 1.5}'), parse_float=decimal.Decimal)),
+            [{'a': decimal.Decimal('1.5')}])
+
+    def test_iterload_lazy(self):
+        it = self.json.JSONDecoder().iterdecode(iter(['[1]\n[2', ']\n[', '3]']))
+        self.assertEqual(next(it), [1])
+        self.assertEqual(next(it), [2])
+        self.assertEqual(next(it), [3])
+        self.assertRaises(StopIteration, next, it)
+
+    def test_iterload_no_read_ahead(self):
+        # A document ending at a chunk boundary is produced before the next
+        # chunk is requested, unless it is a number that may continue.
+        requested = []
+        def chunks():
+            for chunk in ['{"a": 1}', '[2]', ' "3"', 'true', '45', '6 ', '[7]']:
+                requested.append(chunk)
+                yield chunk
+        it = self.json.JSONDecoder().iterdecode(chunks())
+        for expected, last in [({'a': 1}, '{"a": 1}'), ([2], '[2]'),
+                               ('3', ' "3"'), (True, 'true'),
+                               (456, '6 '), ([7], '[7]')]:
+            self.assertEqual(next(it), expected)
+            self.assertEqual(requested[-1], last)
+        self.assertRaises(StopIteration, next, it)
+
+    def test_iterload_invalid(self):
+        it = self.json.iterload(StringIO('[1] {"a" 2} [3]'))
+        self.assertEqual(next(it), [1])
+        with self.assertRaisesRegex(self.JSONDecodeError,
+                                    "Expecting ':' delimiter"):
+            next(it)
+        it = self.json.iterload(StringIO('[1] [2'))
+        self.assertEqual(next(it), [1])
+        self.assertRaises(self.JSONDecodeError, next, it)
+        it = self.json.iterload(BytesIO('[1] "\u20ac"'.encode()[:-2]))
+        self.assertEqual(next(it), [1])
+        self.assertRaises(UnicodeDecodeError, next, it)
+
+    def test_iterload_invalid_early(self):
+        # Invalid data is reported without waiting for the end of the
+        # stream, which may never come.
+        chunks = itertools.chain(['[1]\n{"a" 2}'], itertools.repeat(' '))
+        it = self.json.JSONDecoder().iterdecode(chunks)
+        self.assertEqual(next(it), [1])
+        self.assertRaises(self.JSONDecodeError, next, it)
+        # But documents cut anywhere are waited for.
+        text = '[1.5, -2e+3, true, false, null, NaN, -Infinity, "\\u20ac"]'
+        it = self.json.JSONDecoder().iterdecode(iter(text))
+        self.assertEqual(list(it), [self.json.loads(text)])
+
+    def test_iterload_error_position(self):
+        text = '[1]\n[2]\n  [3, x]\n[4]\n'
+        for chunk_size in (1, 4, 65536):
+            with self.subTest(chunk_size=chunk_size):
+                it = self.json.iterload(StringIO(text), chunk_size=chunk_size)
+                with self.assertRaises(self.JSONDecodeError) as cm:
+                    list(it)
+                err = cm.exception
+                self.assertEqual(err.pos, 14)
+                self.assertEqual(err.lineno, 3)
+                self.assertEqual(err.colno, 7)
+                self.assertIn('line 3 column 7 (char 14)', str(err))
+                # Reported at the end of the stream.
+                it = self.json.iterload(StringIO('[1]\n[2]\n  [3, 4'),
+                                        chunk_size=chunk_size)
+                with self.assertRaises(self.JSONDecodeError) as cm:
+                    list(it)
+                err = cm.exception
+                self.assertEqual((err.pos, err.lineno, err.colno), (15, 3, 8))
+
 class TestPyDecode(TestDecode, PyTest): pass
 class TestCDecode(TestDecode, CTest): pass
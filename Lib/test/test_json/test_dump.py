@@ -30,6 +30,32 @@ def test_encode_truefalse(self):
                 {2: 3.0, 4.0: 5, False: 1, 6: True}, sort_keys=True),
                 '{"false": 1, "2": 3.0, "4.0": 5, "6": true}')
 
+    def test_dump_large(self):
+        writes = []
+        class Writer:
+            def write(self, s):
+                self.assertIsInstance(s, str)
+                writes.append(s)
+        Writer.assertIsInstance = self.assertIsInstance
+        obj = [{'key': i, 'value': [str(i)] * 3} for i in range(20000)]
+        self.json.dump(obj, Writer())
+        self.assertEqual(''.join(writes), self.dumps(obj))
+        self.assertGreater(len(writes), 1)
+
+        del writes[:]
+        self.json.dump(obj, Writer(), indent=2)
+        self.assertEqual(''.join(writes), self.dumps(obj, indent=2))
+
+    def test_dump_overridden_iterencode(self):
+        class Encoder(self.json.JSONEncoder):
+            def iterencode(self, o, _one_shot=False):
+                yield '<'
+                yield from super().iterencode(o, _one_shot)
+                yield '>'
+        sio = StringIO()
+        self.json.dump([1, {'a': 2}], sio, cls=Encoder)
+        self.assertEqual(sio.getvalue(), '<[1, {"a": 2}]>')
+
     # Issue 16228: Crash on encoding resized list
     def test_encode_mutated(self):
         a = [object()] * 10
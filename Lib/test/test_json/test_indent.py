@@ -1,6 +1,6 @@
 import textwrap
 from io import StringIO
-from test.test_json import PyTest, CTest
+from test.test_json import PyTest, CTest, pyjson
 
 
 class TestIndent:
@@ -64,4 +64,29 @@ def check(indent, expected):
 
 
 class TestPyIndent(TestIndent, PyTest): pass
-class TestCIndent(TestIndent, CTest): pass
+
+class TestCIndent(TestIndent, CTest):
+    def test_indent_matches_pure_python(self):
+        h = {'a': [1, 2.5, None, True, {'b': [], 'c': {}}],
+             'd': {'e': [[], [[]], [{}]], 'f': 'g\u20ac'},
+             3: (4, 5), 1.5: False, None: 'h'}
+        for kwargs in [dict(indent=0), dict(indent=4), dict(indent='\t'),
+                       dict(indent=-1), dict(indent=2, skipkeys=True),
+                       dict(indent='--', separators=(';', '=')),
+                       dict(indent=1, ensure_ascii=False)]:
+            with self.subTest(**kwargs):
+                expected = pyjson.dumps(h, **kwargs)
+                self.assertEqual(self.dumps(h, **kwargs), expected)
+                sio = StringIO()
+                self.json.dump(h, sio, **kwargs)
+                self.assertEqual(sio.getvalue(), expected)
+        h = {'b': [{'d': 1, 'c': 2}], 'a': {'f': [], 'e': 3}}
+        self.assertEqual(self.dumps(h, indent=2, sort_keys=True),
+                         pyjson.dumps(h, indent=2, sort_keys=True))
+
+    def test_bad_indent(self):
+        with self.assertRaises(TypeError):
+            self.dumps([1], indent=1.5)
+        self.assertRaises(TypeError, self.json.encoder.c_make_encoder,
+                          None, None, None, 2, ': ', ', ',
+                          False, False, False)
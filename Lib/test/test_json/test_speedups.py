@@ -22,6 +22,36 @@ class TestDecode(CTest):
     def test_make_scanner(self):
         self.assertRaises(AttributeError, self.json.scanner.c_make_scanner, 1)
 
+    def test_keys_reuse_across_calls(self):
+        decoder = self.json.decoder.JSONDecoder()
+        first = decoder.decode('{"a_key": 1, "b_\xe9": 2}')
+        # The second document uses a wider kind for the same keys.
+        second = decoder.decode('{"a_key": 3, "b_\xe9": "\u20ac"}')
+        for k1, k2 in zip(first, second):
+            self.assertIs(k1, k2)
+        self.assertFalse(decoder.memo)
+
+    def test_key_cache(self):
+        decoder = self.json.decoder.JSONDecoder(strict=False)
+        docs = ['{"a": 1, "b": {"a": [], "c": 2}}',
+                '{"a\\"b": 1, "a\\u0041": 2, "k\x01": 3}',
+                '{"%s": 1}' % ('x' * 100),
+                '{"%s": 1, "": 2}' % ('\U0001f600' * 3),
+                '{"a": 1, "a": 2, "b": 3}']
+        # Objects of varying sizes starting with the same key.
+        for n in (1, 20, 3, 0, 50):
+            docs.append('{%s}' % ', '.join('"k%d": %d' % (i, i)
+                                           for i in range(n)))
+        for _ in range(2):
+            for doc in docs:
+                self.assertEqual(decoder.decode(doc),
+                                 self.json.decoder.JSONDecoder(
+                                     strict=False).decode(doc))
+        self.assertEqual(decoder.decode('{"a": 1, "a": 2, "b": 3}'),
+                         {'a': 2, 'b': 3})
+        self.assertEqual(decoder.decode('{"k1": 1, "k0": 0}'),
+                         {'k1': 1, 'k0': 0})
+
     def test_bad_bool_args(self):
         def test(value):
             self.json.decoder.JSONDecoder(strict=BadBool()).decode(value)
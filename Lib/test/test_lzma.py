@@ -283,6 +283,26 @@ def test_roundtrip_xz(self):
         lzd = LZMADecompressor()
         self._test_decompressor(lzd, cdata, lzma.CHECK_CRC64)
 
+    def test_roundtrip_xz_threads(self):
+        for threads in (0, 2):
+            lzc = LZMACompressor(threads=threads)
+            cdata = lzc.compress(INPUT) + lzc.flush()
+            lzd = LZMADecompressor()
+            self._test_decompressor(lzd, cdata, lzma.CHECK_CRC64)
+        lzc = LZMACompressor(check=lzma.CHECK_SHA256, filters=FILTERS_RAW_1,
+                             threads=2)
+        cdata = lzc.compress(INPUT) + lzc.flush()
+        lzd = LZMADecompressor()
+        self._test_decompressor(lzd, cdata, lzma.CHECK_SHA256)
+
+    def test_threads_bad_args(self):
+        self.assertRaises(TypeError, LZMACompressor, threads="2")
+        self.assertRaises(ValueError, LZMACompressor, threads=-1)
+        with self.assertRaises(ValueError):
+            LZMACompressor(lzma.FORMAT_ALONE, threads=2)
+        with self.assertRaises(ValueError):
+            LZMACompressor(lzma.FORMAT_RAW, filters=FILTERS_RAW_1, threads=0)
+
     def test_roundtrip_alone(self):
         lzc = LZMACompressor(lzma.FORMAT_ALONE)
         cdata = lzc.compress(INPUT) + lzc.flush()
@@ -396,6 +416,7 @@ def test_bad_args(self):
         # Can't specify a preset and a custom filter chain at the same time.
         with self.assertRaises(ValueError):
             lzma.compress(b"", preset=3, filters=[{"id": lzma.FILTER_LZMA2}])
+        self.assertRaises(ValueError, lzma.compress, b"", threads=-1)
 
         self.assertRaises(TypeError, lzma.decompress)
         self.assertRaises(TypeError, lzma.decompress, [])
@@ -492,6 +513,10 @@ def test_roundtrip(self):
         ddata = lzma.decompress(cdata)
         self.assertEqual(ddata, INPUT)
 
+        cdata = lzma.compress(INPUT, lzma.FORMAT_XZ, threads=2)
+        ddata = lzma.decompress(cdata)
+        self.assertEqual(ddata, INPUT)
+
         cdata = lzma.compress(INPUT, lzma.FORMAT_ALONE)
         ddata = lzma.decompress(cdata)
         self.assertEqual(ddata, INPUT)
@@ -649,6 +674,17 @@ def test_init_bad_preset(self):
         with self.assertRaises(ValueError):
             LZMAFile(BytesIO(COMPRESSED_XZ), preset=3)
 
+    def test_init_threads(self):
+        with BytesIO() as dst:
+            with LZMAFile(dst, "w", threads=2) as f:
+                f.write(INPUT)
+            self.assertEqual(lzma.decompress(dst.getvalue()), INPUT)
+        with self.assertRaises(ValueError):
+            LZMAFile(BytesIO(), "w", format=lzma.FORMAT_ALONE, threads=2)
+        # Cannot specify a number of threads with mode="r".
+        with self.assertRaises(ValueError):
+            LZMAFile(BytesIO(COMPRESSED_XZ), threads=2)
+
     def test_init_bad_filter_spec(self):
         with self.assertRaises(TypeError):
             LZMAFile(BytesIO(), "w", filters=[b"wobsite"])
@@ -2573,6 +2573,64 @@ def _testRecvFromNegative(self):
         self.cli.sendto(MSG, 0, (HOST, self.port))
 
 
+@unittest.skipUnless(hasattr(socket.socket, "recvmmsg_into") and
+                     hasattr(socket.socket, "sendmmsg"),
+                     "recvmmsg_into() and sendmmsg() required for this test")
+class BatchedUDPTest(ThreadedUDPSocketTest):
+
+    datagrams = [b'first', b'', b'third datagram', MSG]
+
+    def __init__(self, methodName='runTest'):
+        ThreadedUDPSocketTest.__init__(self, methodName=methodName)
+
+    def testSendmmsgAndRecvmmsgInto(self):
+        bufs = [bytearray(64) for _ in range(len(self.datagrams) + 2)]
+        received = []
+        while len(received) < len(self.datagrams):
+            results = self.serv.recvmmsg_into(bufs)
+            self.assertGreater(len(results), 0)
+            for buf, (nbytes, addr, flags) in zip(bufs, results):
+                self.assertEqual(len(addr), 2)
+                self.assertEqual(flags & socket.MSG_TRUNC, 0)
+                received.append(bytes(buf[:nbytes]))
+        self.assertEqual(received, self.datagrams)
+
+    def _testSendmmsgAndRecvmmsgInto(self):
+        sent = self.cli.sendmmsg(self.datagrams, 0, (HOST, self.port))
+        self.assertEqual(sent, len(self.datagrams))
+
+    def testRecvmmsgIntoTruncates(self):
+        bufs = [bytearray(4), bytearray(4)]
+        received = []
+        while len(received) < 2:
+            for buf, (nbytes, addr, flags) in zip(
+                    bufs, self.serv.recvmmsg_into(bufs)):
+                received.append((nbytes, bytes(buf[:nbytes]),
+                                 bool(flags & socket.MSG_TRUNC)))
+        self.assertEqual(received, [(4, b'0123', True), (2, b'ab', False)])
+
+    def _testRecvmmsgIntoTruncates(self):
+        self.cli.connect((HOST, self.port))
+        self.assertEqual(self.cli.sendmmsg([b'0123456789', b'ab']), 2)
+
+    def testRecvmmsgIntoEmpty(self):
+        self.assertEqual(self.serv.recvmmsg_into([]), [])
+        self.assertEqual(self.serv.sendmmsg([], 0, (HOST, self.port)), 0)
+
+    def _testRecvmmsgIntoEmpty(self):
+        pass
+
+    def testRecvmmsgIntoBadArgs(self):
+        self.assertRaises(TypeError, self.serv.recvmmsg_into)
+        self.assertRaises(TypeError, self.serv.recvmmsg_into, 1)
+        self.assertRaises(TypeError, self.serv.recvmmsg_into, [b'readonly'])
+        self.assertRaises(TypeError, self.serv.sendmmsg, [1])
+        self.assertRaises(TypeError, self.serv.sendmmsg, [b'x'], 0, 'bad')
+
+    def _testRecvmmsgIntoBadArgs(self):
+        pass
+
+
 @unittest.skipUnless(HAVE_SOCKET_UDPLITE,
           'UDPLITE sockets required for this test.')
 class BasicUDPLITETest(ThreadedUDPLITESocketTest):
@@ -6597,11 +6655,134 @@ def close_fds(fds):
             self.assertEqual(data,  str(index).encode())
 
 
+@requireAttrs(socket.socket, "zerocopy_completions")
+@requireAttrs(socket, "SO_ZEROCOPY", "MSG_ZEROCOPY")
+class ZeroCopyTests(unittest.TestCase):
+
+    def setUp(self):
+        self.serv = socket.create_server((HOST, 0))
+        self.addCleanup(self.serv.close)
+        self.cli = socket.create_connection(self.serv.getsockname())
+        self.addCleanup(self.cli.close)
+        self.conn, _ = self.serv.accept()
+        self.addCleanup(self.conn.close)
+        try:
+            self.cli.setsockopt(socket.SOL_SOCKET, socket.SO_ZEROCOPY, 1)
+        except OSError as e:
+            self.skipTest(f"SO_ZEROCOPY not supported: {e}")
+
+    def wait_completions(self, count):
+        completions = []
+        done = 0
+        deadline = time.monotonic() + support.SHORT_TIMEOUT
+        while done < count:
+            if time.monotonic() > deadline:
+                self.fail("timed out waiting for zero-copy completions")
+            for first, last, copied in self.cli.zerocopy_completions():
+                self.assertIsInstance(copied, bool)
+                self.assertEqual(first, done)
+                self.assertGreaterEqual(last, first)
+                done = last + 1
+                completions.append((first, last))
+            time.sleep(0.01)
+        return completions
+
+    def recv_exactly(self, size):
+        data = bytearray()
+        while len(data) < size:
+            data += self.conn.recv(size - len(data))
+        return data
+
+    def testNoCompletions(self):
+        self.assertEqual(self.cli.zerocopy_completions(), [])
+        self.cli.sendall(b'plain')
+        self.assertEqual(self.recv_exactly(5), b'plain')
+        self.assertEqual(self.cli.zerocopy_completions(), [])
+
+    def testSendZeroCopy(self):
+        bufs = [bytes([i]) * 64 * 1024 for i in range(3)]
+        for buf in bufs:
+            self.assertEqual(self.cli.send(buf, socket.MSG_ZEROCOPY),
+                             len(buf))
+        self.assertEqual(self.recv_exactly(3 * 64 * 1024), b''.join(bufs))
+        self.wait_completions(3)
+        self.assertEqual(self.cli.zerocopy_completions(), [])
+
+    def testSendmsgZeroCopy(self):
+        buf = b'x' * 32 * 1024
+        self.cli.sendmsg([buf], [], socket.MSG_ZEROCOPY)
+        self.assertEqual(self.recv_exactly(len(buf)), buf)
+        self.assertEqual(self.wait_completions(1), [(0, 0)])
+
+    def testBufferKeptUntilCompletion(self):
+        # The socket keeps the buffers exported until their completion is
+        # read: a bytearray cannot be resized meanwhile.
+        bufs = [bytearray(64 * 1024) for _ in range(3)]
+        self.cli.send(bufs[0], socket.MSG_ZEROCOPY)
+        self.cli.sendall(bufs[1], socket.MSG_ZEROCOPY)
+        self.cli.sendmsg([bufs[2]], [], socket.MSG_ZEROCOPY)
+        for buf in bufs:
+            self.assertRaises(BufferError, buf.extend, b'x')
+        self.recv_exactly(3 * 64 * 1024)
+        self.wait_completions(3)
+        for buf in bufs:
+            buf.extend(b'x')
+
+    def testBufferReleasedOnClose(self):
+        buf = bytearray(64 * 1024)
+        self.cli.send(buf, socket.MSG_ZEROCOPY)
+        self.assertRaises(BufferError, buf.extend, b'x')
+        self.cli.close()
+        buf.extend(b'x')
+
+    def testNoZeroCopyWithoutSockopt(self):
+        # Without SO_ZEROCOPY the kernel ignores MSG_ZEROCOPY, and the
+        # buffer is not kept.
+        self.cli.setsockopt(socket.SOL_SOCKET, socket.SO_ZEROCOPY, 0)
+        buf = bytearray(64 * 1024)
+        self.cli.send(buf, socket.MSG_ZEROCOPY)
+        buf.extend(b'x')
+        self.recv_exactly(64 * 1024)
+        self.assertEqual(self.cli.zerocopy_completions(), [])
+
+    @requireAttrs(socket, "IP_RECVERR")
+    def testQueuedErrorAndCompletion(self):
+        # The ICMP error and the completion can be queued in either
+        # order: neither is lost.
+        with socket.socket(socket.AF_INET, socket.SOCK_DGRAM) as closed:
+            closed.bind((HOST, 0))
+            addr = closed.getsockname()
+        with socket.socket(socket.AF_INET, socket.SOCK_DGRAM) as sock:
+            try:
+                sock.setsockopt(socket.SOL_SOCKET, socket.SO_ZEROCOPY, 1)
+            except OSError as e:
+                self.skipTest(f"SO_ZEROCOPY not supported for UDP: {e}")
+            sock.setsockopt(socket.IPPROTO_IP, socket.IP_RECVERR, 1)
+            buf = bytearray(100)
+            sock.sendto(buf, socket.MSG_ZEROCOPY, addr)
+            completions = []
+            errors = 0
+            deadline = time.monotonic() + support.SHORT_TIMEOUT
+            while not (completions and errors):
+                if time.monotonic() > deadline:
+                    self.fail("timed out waiting for the completion and "
+                              "the error")
+                try:
+                    completions += sock.zerocopy_completions()
+                except ConnectionRefusedError:
+                    errors += 1
+                time.sleep(0.01)
+            self.assertEqual([c[:2] for c in completions], [(0, 0)])
+            self.assertEqual(errors, 1)
+            self.assertEqual(sock.zerocopy_completions(), [])
+            buf.extend(b'x')
+
+
 def test_main():
     tests = [GeneralModuleTests, BasicTCPTest, TCPCloserTest, TCPTimeoutTest,
              TestExceptions, BufferIOTest, BasicTCPTest2, BasicUDPTest,
-             UDPTimeoutTest, CreateServerTest, CreateServerFunctionalTest,
-             SendRecvFdsTests]
+             BatchedUDPTest, UDPTimeoutTest, CreateServerTest, CreateServerFunctionalTest,
+             SendRecvFdsTests, ZeroCopyTests]
 
     tests.extend([
         NonBlockingTCPTests,
@@ -378,6 +378,48 @@ def test_not_all_tuples(self):
         self.assertRaises(TypeError, [(1.0, 1.0), (False, "A"), 6].sort)
         self.assertRaises(TypeError, [('a', 1), (1, 'a')].sort)
         self.assertRaises(TypeError, [(1, 'a'), ('a', 1)].sort)
+
+class TestRadixSort(unittest.TestCase):
+    # Large lists of bounded ints or of floats are radix sorted when no key
+    # function is given.  The result must be exactly what timsort gives,
+    # which is what we get by passing an identity key function.
+
+    def check(self, L):
+        for reverse in False, True:
+            expected = sorted(L, key=lambda x: x, reverse=reverse)
+            got = sorted(L, reverse=reverse)
+            self.assertEqual(len(got), len(expected))
+            for x, y in zip(got, expected):
+                self.assertIs(x, y)
+
+    def test_ints(self):
+        n = 5000
+        self.check([random.randrange(-1000, 1000) for _ in range(n)])
+        self.check([random.randrange(-2**30 + 1, 2**30) for _ in range(n)])
+        # Many equal but distinct objects, to check stability.
+        self.check([int(str(random.randrange(1000, 1010))) for _ in range(n)])
+
+    def test_floats(self):
+        n = 5000
+        self.check([random.random() for _ in range(n)])
+        self.check([random.uniform(-1e300, 1e300) for _ in range(n)])
+        self.check([random.choice([0.0, -0.0, 1.0, -1.0, float('inf'),
+                                   float('-inf'), 5e-324, -5e-324])
+                    for _ in range(n)])
+        self.check([float(random.randrange(10)) for _ in range(n)])
+
+    def test_nan(self):
+        L = [random.random() for _ in range(5000)]
+        L[1234] = float('nan')
+        self.check(L)
+
+    def test_partially_ordered(self):
+        L = list(range(5000))
+        L[100], L[4000] = L[4000], L[100]
+        self.check(L)
+        self.check(L[::-1])
+        self.check([float(x) for x in L])
+
 #==============================================================================
 
 if __name__ == "__main__":
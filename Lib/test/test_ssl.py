@@ -4285,6 +4285,39 @@ def test_sendfile(self):
                     s.sendfile(file)
                     self.assertEqual(s.recv(1024), TEST_DATA)
 
+    @unittest.skipUnless(hasattr(ssl, 'OP_ENABLE_KTLS'),
+                         "ssl.OP_ENABLE_KTLS needed for this test")
+    def test_sendfile_ktls(self):
+        TEST_DATA = b"x" * 512
+        with open(os_helper.TESTFN, 'wb') as f:
+            f.write(TEST_DATA)
+        self.addCleanup(os_helper.unlink, os_helper.TESTFN)
+        client_context, server_context, hostname = testing_context()
+        client_context.options |= ssl.OP_ENABLE_KTLS
+        server_context.options |= ssl.OP_ENABLE_KTLS
+        server = ThreadedEchoServer(context=server_context, chatty=False)
+        with server:
+            with client_context.wrap_socket(socket.socket(),
+                                            server_hostname=hostname) as s:
+                self.assertIs(s.uses_ktls_for_send(), False)
+                self.assertIs(s.uses_ktls_for_recv(), False)
+                s.connect((HOST, server.port))
+                ktls_send = s.uses_ktls_for_send()
+                self.assertIsInstance(ktls_send, bool)
+                self.assertIsInstance(s.uses_ktls_for_recv(), bool)
+                if support.verbose:
+                    sys.stdout.write(" kTLS send: {!r}\n".format(ktls_send))
+                with open(os_helper.TESTFN, 'rb') as file:
+                    if ktls_send:
+                        # The kernel encrypts: os.sendfile() must be used
+                        with unittest.mock.patch.object(
+                                s, '_sendfile_use_send',
+                                side_effect=AssertionError):
+                            s.sendfile(file)
+                    else:
+                        s.sendfile(file)
+                    self.assertEqual(s.recv(1024), TEST_DATA)
+
     def test_session(self):
         client_context, server_context, hostname = testing_context()
         # TODO: sessions aren't compatible with TLSv1.3 yet
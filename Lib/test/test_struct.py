@@ -856,5 +856,82 @@ def test_half_float(self):
             self.assertEqual(bits, struct.pack(formatcode, f))
 
 
+class ColumnsTest(unittest.TestCase):
+    """
+    Tests for columnar packing (struct.Struct.unpack_columns and
+    struct.Struct.pack_columns).
+    """
+
+    def test_roundtrip(self):
+        s = struct.Struct('<i2hd3sx?p')
+        records = [(i, -i, 2 * i, i / 3, b'ab%d' % (i % 10), i % 2 == 0,
+                    b'x' * (i % 3))
+                   for i in range(50)]
+        data = b''.join(s.pack(*r) for r in records)
+        columns = s.unpack_columns(data)
+        self.assertIsInstance(columns, tuple)
+        self.assertEqual(len(columns), 7)
+        for column in columns[:4]:
+            self.assertIsInstance(column, memoryview)
+            self.assertTrue(column.readonly)
+        for column in columns[4:]:
+            self.assertIsInstance(column, list)
+        self.assertEqual(list(zip(*columns)), list(s.iter_unpack(data)))
+        self.assertEqual(s.pack_columns(*columns), data)
+        self.assertEqual(s.pack_columns(*map(tuple, columns)), data)
+        self.assertEqual(s.unpack_columns(memoryview(data)), columns)
+
+    def test_column_views(self):
+        # Numeric columns are views in native byte order, whatever the
+        # byte order of the records.
+        values = ([-2, 3], [40000, 1], [-5, 2**40], [2**64 - 1, 7],
+                  [b'a', b'b'], [1.5, -0.25], [2.5, 1e300])
+        for prefix in '<>!=@':
+            with self.subTest(prefix=prefix):
+                s = struct.Struct(prefix + 'bHqQcfd')
+                columns = s.unpack_columns(s.pack_columns(*values))
+                self.assertEqual([c.format for c in columns],
+                                 ['b', 'H', 'q', 'Q', 'c', 'f', 'd'])
+                self.assertEqual([c.tolist() for c in columns], list(values))
+        s = struct.Struct('<e?')
+        self.assertEqual(s.unpack_columns(s.pack(1.5, True)), ([1.5], [True]))
+
+    def test_empty(self):
+        s = struct.Struct('>IB')
+        columns = s.unpack_columns(b'')
+        self.assertEqual([c.tolist() for c in columns], [[], []])
+        self.assertEqual(s.pack_columns([], ()), b'')
+
+    def test_unpack_errors(self):
+        s = struct.Struct('>IB')
+        with self.assertRaises(struct.error):
+            s.unpack_columns(b'123456')
+        with self.assertRaises(TypeError):
+            s.unpack_columns('12345')
+        with self.assertRaises(struct.error):
+            struct.Struct('>').unpack_columns(b'')
+
+    def test_pack_errors(self):
+        s = struct.Struct('>IB')
+        with self.assertRaises(struct.error):
+            s.pack_columns([1])
+        with self.assertRaises(struct.error):
+            s.pack_columns([1, 2], [3])
+        with self.assertRaises(TypeError):
+            s.pack_columns(1, 2)
+        with self.assertRaises(struct.error):
+            s.pack_columns([1], [256])
+
+    def test_pack_mutating_column(self):
+        class Evil:
+            def __index__(self):
+                column.clear()
+                return 1
+        s = struct.Struct('>I')
+        column = [Evil(), Evil()]
+        with self.assertRaises(RuntimeError):
+            s.pack_columns(column)
+
+
 if __name__ == '__main__':
     unittest.main()
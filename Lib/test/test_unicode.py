@@ -2229,6 +2229,76 @@ def test_concatenation(self):
         self.assertEqual(("abc" "def" "ghi"), "abcdefghi")
         self.assertEqual(("abc" "def" "ghi"), "abcdefghi")
 
+    def test_inplace_concatenation(self):
+        # CPython resizes the string in place when the target of += holds
+        # the only other reference.  Check the targets where it does that
+        # behave like any other assignment.
+        global _concat_global
+        class C:
+            pass
+        o = C()
+        o.s = ''.join(['x', 'y'])
+        for i in range(100):
+            o.s += 'abc'
+        self.assertEqual(o.s, 'xy' + 'abc' * 100)
+
+        d = {'k': ''.join(['x', 'y'])}
+        l = [''.join(['x', 'y'])]
+        for i in range(100):
+            d['k'] += 'abc'
+            l[-1] += 'abc'
+        self.assertEqual(d['k'], 'xy' + 'abc' * 100)
+        self.assertEqual(l[0], 'xy' + 'abc' * 100)
+
+        _concat_global = ''.join(['x', 'y'])
+        for i in range(100):
+            _concat_global += 'abc'
+        self.assertEqual(_concat_global, 'xy' + 'abc' * 100)
+        del _concat_global
+
+        # Other references to the old value must not see the change.
+        o.s = ''.join(['x', 'y'])
+        old = o.s
+        o.s += 'abc'
+        self.assertEqual(old, 'xy')
+        self.assertEqual(o.s, 'xyabc')
+
+        # Stores that go through __setattr__ or a descriptor must see the
+        # old value untouched in the instance dict.
+        seen = []
+        class D:
+            def __setattr__(self, name, value):
+                seen.append(self.__dict__[name])
+                object.__setattr__(self, name, value)
+        o = D()
+        o.__dict__['s'] = ''.join(['x', 'y'])
+        o.s += 'abc'
+        self.assertEqual(seen, ['xy'])
+        self.assertEqual(o.s, 'xyabc')
+
+        class E:
+            @property
+            def s(self):
+                return self.__dict__['s']
+            @s.setter
+            def s(self, value):
+                seen.append(self.__dict__['s'])
+                self.__dict__['t'] = value
+        seen.clear()
+        o = E()
+        o.__dict__['s'] = ''.join(['x', 'y'])
+        o.s += 'abc'
+        self.assertEqual(seen, ['xy'])
+        self.assertEqual(o.__dict__, {'s': 'xy', 't': 'xyabc'})
+
+        # Subscripts that aren't exact str keys or int indices.
+        d = {1: ''.join(['x', 'y']), 'k': ''.join(['x', 'y'])}
+        d[1] += 'abc'
+        self.assertEqual(d, {1: 'xyabc', 'k': 'xy'})
+        l = [''.join(['x', 'y']), ''.join(['x', 'y'])]
+        l[True] += 'abc'
+        self.assertEqual(l, ['xy', 'xyabc'])
+
     def test_ucs4(self):
         x = '\U00100000'
         y = x.encode("raw-unicode-escape").decode("raw-unicode-escape")
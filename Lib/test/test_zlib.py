@@ -74,6 +74,16 @@ def test_same_as_binascii_crc32(self):
         self.assertEqual(zlib.crc32(foo), crc)
         self.assertEqual(binascii.crc32(b'spam'), zlib.crc32(b'spam'))
 
+    def test_crc32_combine(self):
+        a = b'abcdefghijklmnop'
+        b = b'spam' * 1000
+        self.assertEqual(zlib.crc32_combine(zlib.crc32(a), zlib.crc32(b),
+                                            len(b)),
+                         zlib.crc32(a + b))
+        self.assertEqual(zlib.crc32_combine(zlib.crc32(a), 0, 0),
+                         zlib.crc32(a))
+        self.assertRaises(ValueError, zlib.crc32_combine, 0, 0, -1)
+
 
 # Issue #10276 - check that inputs >=4 GiB are handled correctly.
 class ChecksumBigBufferTestCase(unittest.TestCase):
@@ -1,5 +1,7 @@
 #include "Python.h"
+#include "pycore_long.h"          // _PyLong_GetOne()
 #include "pycore_pyerrors.h"      // _PyErr_ClearExcState()
+#include "structmember.h"         // PyMemberDef
 #include <stddef.h>               // offsetof()
 
 
@@ -28,8 +30,12 @@ static PyObject *asyncio_iscoroutine_func;
 static PyObject *asyncio_task_get_stack_func;
 static PyObject *asyncio_task_print_stack_func;
 static PyObject *asyncio_task_repr_info_func;
+static PyObject *asyncio_format_callback_source_func;
+static PyObject *asyncio_extract_stack_func;
 static PyObject *asyncio_InvalidStateError;
 static PyObject *asyncio_CancelledError;
+static PyObject *heapq_heappop;
+static PyObject *heapq_heapify;
 static PyObject *context_kwname;
 static int module_initialized;
 
@@ -101,10 +107,33 @@ typedef struct {
 #endif
 } PyRunningLoopHolder;
 
+#define HandleObj_HEAD(prefix)                                              \
+    PyObject_HEAD                                                           \
+    PyObject *prefix##_callback;                                            \
+    PyObject *prefix##_args;                                                \
+    PyObject *prefix##_loop;                                                \
+    PyObject *prefix##_context;                                             \
+    PyObject *prefix##_source_tb;                                           \
+    PyObject *prefix##_repr;                                                \
+    PyObject *prefix##_weakreflist;                                         \
+    char prefix##_cancelled;
+
+typedef struct {
+    HandleObj_HEAD(h)
+} HandleObj;
+
+typedef struct {
+    HandleObj_HEAD(h)
+    PyObject *th_when;
+    char th_scheduled;
+} TimerHandleObj;
+
 
 static PyTypeObject FutureType;
 static PyTypeObject TaskType;
 static PyTypeObject PyRunningLoopHolder_Type;
+static PyTypeObject HandleType;
+static PyTypeObject TimerHandleType;
 
 
 #define Future_CheckExact(obj) Py_IS_TYPE(obj, &FutureType)
@@ -112,14 +141,19 @@ static PyTypeObject PyRunningLoopHolder_Type;
 
 #define Future_Check(obj) PyObject_TypeCheck(obj, &FutureType)
 #define Task_Check(obj) PyObject_TypeCheck(obj, &TaskType)
+#define TimerHandle_Check(obj) PyObject_TypeCheck(obj, &TimerHandleType)
+#define Handle_CheckExact(obj) Py_IS_TYPE(obj, &HandleType)
+#define TimerHandle_CheckExact(obj) Py_IS_TYPE(obj, &TimerHandleType)
 
 #include "clinic/_asynciomodule.c.h"
 
 
 /*[clinic input]
 class _asyncio.Future "FutureObj *" "&Future_Type"
+class _asyncio.Handle "HandleObj *" "&HandleType"
+class _asyncio.TimerHandle "TimerHandleObj *" "&TimerHandleType"
 [clinic start generated code]*/
-/*[clinic end generated code: output=da39a3ee5e6b4b0d input=00d3e4abca711e0f]*/
+/*[clinic end generated code: output=da39a3ee5e6b4b0d input=df27cb4e5ffe9412]*/
 
 
 /* Get FutureIter from Future */
@@ -1807,6 +1841,7 @@ class _asyncio.Task "TaskObj *" "&Task_Type"
 /*[clinic end generated code: output=da39a3ee5e6b4b0d input=719dcef0fcc03b37]*/
 
 static int task_call_step_soon(TaskObj *, PyObject *);
+static int task_eager_start(TaskObj *);
 static PyObject * task_wakeup(TaskObj *, PyObject *);
 static PyObject * task_step(TaskObj *, PyObject *);
 
@@ -1993,6 +2028,40 @@ leave_task(PyObject *loop, PyObject *task)
     return _PyDict_DelItem_KnownHash(current_tasks, loop, hash);
 }
 
+static PyObject *
+swap_current_task(PyObject *loop, PyObject *task)
+{
+    /* Make task (or no task if task is None) the current task of loop
+       and return the previous current task or None. */
+    PyObject *prev;
+    Py_hash_t hash;
+    hash = PyObject_Hash(loop);
+    if (hash == -1) {
+        return NULL;
+    }
+    prev = _PyDict_GetItem_KnownHash(current_tasks, loop, hash);
+    if (prev == NULL) {
+        if (PyErr_Occurred()) {
+            return NULL;
+        }
+        prev = Py_None;
+    }
+    Py_INCREF(prev);
+    if (task != Py_None) {
+        if (_PyDict_SetItem_KnownHash(current_tasks, loop, task, hash) < 0) {
+            Py_DECREF(prev);
+            return NULL;
+        }
+    }
+    else if (prev != Py_None) {
+        if (_PyDict_DelItem_KnownHash(current_tasks, loop, hash) < 0) {
+            Py_DECREF(prev);
+            return NULL;
+        }
+    }
+    return prev;
+}
+
 /* ----- Task */
 
 /*[clinic input]
@@ -2002,14 +2071,15 @@ _asyncio.Task.__init__
     *
     loop: object = None
     name: object = None
+    eager_start: bool = False
 
 A coroutine wrapped in a Future.
 [clinic start generated code]*/
 
 static int
 _asyncio_Task___init___impl(TaskObj *self, PyObject *coro, PyObject *loop,
-                            PyObject *name)
-/*[clinic end generated code: output=88b12b83d570df50 input=352a3137fe60091d]*/
+                            PyObject *name, int eager_start)
+/*[clinic end generated code: output=0e505cba3b853ad5 input=f29f6d18104e54f4]*/
 {
     if (future_init((FutureObj*)self, loop)) {
         return -1;
@@ -2050,6 +2120,23 @@ _asyncio_Task___init___impl(TaskObj *self, PyObject *coro, PyObject *loop,
         return -1;
     }
 
+    if (eager_start) {
+        _Py_IDENTIFIER(is_running);
+        PyObject *res = _PyObject_CallMethodIdNoArgs(self->task_loop,
+                                                     &PyId_is_running);
+        if (res == NULL) {
+            return -1;
+        }
+        int is_running = PyObject_IsTrue(res);
+        Py_DECREF(res);
+        if (is_running < 0) {
+            return -1;
+        }
+        if (is_running) {
+            return task_eager_start(self);
+        }
+    }
+
     if (task_call_step_soon(self, NULL)) {
         return -1;
     }
@@ -2526,6 +2613,52 @@ TaskObj_dealloc(PyObject *self)
     Py_TYPE(task)->tp_free(task);
 }
 
+static int
+task_eager_start(TaskObj *task)
+{
+    /* Run the first step of the task synchronously, the way the loop
+       would have run it, but on top of whatever task is currently
+       running.  The task only gets scheduled if the coroutine suspends. */
+    PyObject *prevtask, *curtask, *res;
+    PyObject *et, *ev, *tb;
+    int retval = 0;
+
+    prevtask = swap_current_task(task->task_loop, Py_None);
+    if (prevtask == NULL) {
+        return -1;
+    }
+
+    if (register_task((PyObject *)task) < 0 ||
+        PyContext_Enter(task->task_context) < 0) {
+        retval = -1;
+    }
+    else {
+        res = task_step(task, NULL);
+        if (res == NULL) {
+            retval = -1;
+        }
+        else {
+            Py_DECREF(res);
+        }
+        if (PyContext_Exit(task->task_context) < 0) {
+            retval = -1;
+        }
+    }
+
+    PyErr_Fetch(&et, &ev, &tb);
+    curtask = swap_current_task(task->task_loop, prevtask);
+    Py_DECREF(prevtask);
+    if (curtask == NULL) {
+        retval = -1;
+    }
+    else {
+        assert(curtask == Py_None);
+        Py_DECREF(curtask);
+    }
+    _PyErr_ChainExceptions(et, ev, tb);
+    return retval;
+}
+
 static int
 task_call_step_soon(TaskObj *task, PyObject *arg)
 {
@@ -3012,167 +3145,1658 @@ task_wakeup(TaskObj *task, PyObject *o)
 }
 
 
-/*********************** Functions **************************/
+/*********************** Handle **************************/
 
 
-/*[clinic input]
-_asyncio._get_running_loop
+#define ENSURE_HANDLE_INITIALIZED(h)                            \
+    do {                                                        \
+        if ((h)->h_loop == NULL) {                              \
+            PyErr_SetString(PyExc_RuntimeError,                 \
+                            "Handle object is not initialized."); \
+            return NULL;                                        \
+        }                                                       \
+    } while(0);
 
-Return the running event loop or None.
+static PyObject *
+none_if_null(PyObject *obj)
+{
+    return obj != NULL ? obj : Py_None;
+}
 
-This is a low-level function intended to be used by event loops.
-This function is thread-specific.
+/* If debug is -1, ask loop.get_debug() whether to record a source
+   traceback. */
+static int
+handle_init(HandleObj *h, PyObject *callback, PyObject *args,
+            PyObject *loop, PyObject *context, int debug)
+{
+    PyObject *res;
+    _Py_IDENTIFIER(get_debug);
 
-[clinic start generated code]*/
+    if (context == Py_None) {
+        context = PyContext_CopyCurrent();
+        if (context == NULL) {
+            return -1;
+        }
+    }
+    else {
+        Py_INCREF(context);
+    }
+    Py_XSETREF(h->h_context, context);
 
-static PyObject *
-_asyncio__get_running_loop_impl(PyObject *module)
-/*[clinic end generated code: output=b4390af721411a0a input=0a21627e25a4bd43]*/
-{
-    PyObject *loop;
-    if (get_running_loop(&loop)) {
-        return NULL;
+    Py_INCREF(loop);
+    Py_XSETREF(h->h_loop, loop);
+    Py_INCREF(callback);
+    Py_XSETREF(h->h_callback, callback);
+    Py_INCREF(args);
+    Py_XSETREF(h->h_args, args);
+    Py_CLEAR(h->h_repr);
+    Py_CLEAR(h->h_source_tb);
+    h->h_cancelled = 0;
+
+    if (debug < 0) {
+        res = _PyObject_CallMethodIdNoArgs(loop, &PyId_get_debug);
+        if (res == NULL) {
+            return -1;
+        }
+        debug = PyObject_IsTrue(res);
+        Py_DECREF(res);
+        if (debug < 0) {
+            return -1;
+        }
     }
-    if (loop == NULL) {
-        /* There's no currently running event loop */
-        Py_RETURN_NONE;
+    if (debug && !_Py_IsFinalizing()) {
+        /* extract_stack() starts from the frame of its caller, which is
+           the Python code that created the handle. */
+        h->h_source_tb = PyObject_CallNoArgs(asyncio_extract_stack_func);
+        if (h->h_source_tb == NULL) {
+            return -1;
+        }
     }
-    return loop;
+
+    return 0;
 }
 
-/*[clinic input]
-_asyncio._set_running_loop
-    loop: 'O'
-    /
+static int
+handle_cancel(HandleObj *h)
+{
+    PyObject *res;
+    int is_true;
+    _Py_IDENTIFIER(get_debug);
 
-Set the running event loop.
+    if (h->h_cancelled) {
+        return 0;
+    }
+    h->h_cancelled = 1;
 
-This is a low-level function intended to be used by event loops.
-This function is thread-specific.
-[clinic start generated code]*/
+    res = _PyObject_CallMethodIdNoArgs(h->h_loop, &PyId_get_debug);
+    if (res == NULL) {
+        return -1;
+    }
+    is_true = PyObject_IsTrue(res);
+    Py_DECREF(res);
+    if (is_true < 0) {
+        return -1;
+    }
+    if (is_true) {
+        /* Keep a representation in debug mode to keep callback and
+           parameters.  For example, to log the warning
+           "Executing <Handle...> took 2.5 second" */
+        PyObject *repr = PyObject_Repr((PyObject *)h);
+        if (repr == NULL) {
+            return -1;
+        }
+        Py_XSETREF(h->h_repr, repr);
+    }
+    Py_CLEAR(h->h_callback);
+    Py_CLEAR(h->h_args);
+    return 0;
+}
 
 static PyObject *
-_asyncio__set_running_loop(PyObject *module, PyObject *loop)
-/*[clinic end generated code: output=ae56bf7a28ca189a input=4c9720233d606604]*/
+handle_call(HandleObj *h)
 {
-    if (set_running_loop(loop)) {
-        return NULL;
+    PyObject *callback = none_if_null(h->h_callback);
+    PyObject *args = none_if_null(h->h_args);
+    PyObject *ctx = none_if_null(h->h_context);
+    PyObject *res = NULL;
+
+    /* The callback may cancel the handle, which drops the handle's
+       references to it. */
+    Py_INCREF(callback);
+    Py_INCREF(ctx);
+    if (PyTuple_CheckExact(args)) {
+        Py_INCREF(args);
+    }
+    else {
+        args = PySequence_Tuple(args);
+        if (args == NULL) {
+            goto finally;
+        }
     }
-    Py_RETURN_NONE;
-}
-
-/*[clinic input]
-_asyncio.get_event_loop
-
-Return an asyncio event loop.
 
-When called from a coroutine or a callback (e.g. scheduled with
-call_soon or similar API), this function will always return the
-running event loop.
+    if (PyContext_CheckExact(ctx)) {
+        if (PyContext_Enter(ctx)) {
+            goto finally;
+        }
+        res = PyObject_Call(callback, args, NULL);
+        if (PyContext_Exit(ctx)) {
+            Py_CLEAR(res);
+        }
+    }
+    else {
+        /* Fall back to ctx.run(callback, *args). */
+        _Py_IDENTIFIER(run);
+        Py_ssize_t i, n = PyTuple_GET_SIZE(args);
+        PyObject *run_args = PyTuple_New(n + 1);
+        if (run_args == NULL) {
+            goto finally;
+        }
+        Py_INCREF(callback);
+        PyTuple_SET_ITEM(run_args, 0, callback);
+        for (i = 0; i < n; i++) {
+            PyObject *item = PyTuple_GET_ITEM(args, i);
+            Py_INCREF(item);
+            PyTuple_SET_ITEM(run_args, i + 1, item);
+        }
+        PyObject *run = _PyObject_GetAttrId(ctx, &PyId_run);
+        if (run != NULL) {
+            res = PyObject_Call(run, run_args, NULL);
+            Py_DECREF(run);
+        }
+        Py_DECREF(run_args);
+    }
 
-If there is no running event loop set, the function will return
-the result of `get_event_loop_policy().get_event_loop()` call.
-[clinic start generated code]*/
+finally:
+    Py_XDECREF(args);
+    Py_DECREF(ctx);
+    Py_DECREF(callback);
+    return res;
+}
 
 static PyObject *
-_asyncio_get_event_loop_impl(PyObject *module)
-/*[clinic end generated code: output=2a2d8b2f824c648b input=9364bf2916c8655d]*/
+handle_repr_info(HandleObj *h)
 {
-    return get_event_loop();
-}
+    PyObject *info, *item;
 
-/*[clinic input]
-_asyncio.get_running_loop
+    info = PyList_New(0);
+    if (info == NULL) {
+        return NULL;
+    }
 
-Return the running event loop.  Raise a RuntimeError if there is none.
+    item = PyUnicode_FromString(_PyType_Name(Py_TYPE(h)));
+    if (item == NULL || PyList_Append(info, item) < 0) {
+        goto error;
+    }
+    Py_DECREF(item);
 
-This function is thread-specific.
-[clinic start generated code]*/
+    if (h->h_cancelled) {
+        item = PyUnicode_FromString("cancelled");
+        if (item == NULL || PyList_Append(info, item) < 0) {
+            goto error;
+        }
+        Py_DECREF(item);
+    }
 
-static PyObject *
-_asyncio_get_running_loop_impl(PyObject *module)
-/*[clinic end generated code: output=c247b5f9e529530e input=2a3bf02ba39f173d]*/
-{
-    PyObject *loop;
-    if (get_running_loop(&loop)) {
-        return NULL;
+    if (h->h_callback != NULL && h->h_callback != Py_None) {
+        item = PyObject_CallFunctionObjArgs(
+            asyncio_format_callback_source_func,
+            h->h_callback, none_if_null(h->h_args), NULL);
+        if (item == NULL || PyList_Append(info, item) < 0) {
+            goto error;
+        }
+        Py_DECREF(item);
     }
-    if (loop == NULL) {
-        /* There's no currently running event loop */
-        PyErr_SetString(
-            PyExc_RuntimeError, "no running event loop");
+
+    if (h->h_source_tb != NULL) {
+        int is_true = PyObject_IsTrue(h->h_source_tb);
+        if (is_true < 0) {
+            goto error_noitem;
+        }
+        if (is_true) {
+            PyObject *frame, *filename, *lineno;
+
+            frame = PySequence_GetItem(h->h_source_tb, -1);
+            if (frame == NULL) {
+                goto error_noitem;
+            }
+            filename = PySequence_GetItem(frame, 0);
+            lineno = filename ? PySequence_GetItem(frame, 1) : NULL;
+            Py_DECREF(frame);
+            if (lineno == NULL) {
+                Py_XDECREF(filename);
+                goto error_noitem;
+            }
+            item = PyUnicode_FromFormat("created at %S:%S", filename, lineno);
+            Py_DECREF(filename);
+            Py_DECREF(lineno);
+            if (item == NULL || PyList_Append(info, item) < 0) {
+                goto error;
+            }
+            Py_DECREF(item);
+        }
     }
-    return loop;
+
+    return info;
+
+error:
+    Py_XDECREF(item);
+error_noitem:
+    Py_DECREF(info);
+    return NULL;
 }
 
 /*[clinic input]
-_asyncio._register_task
+_asyncio.Handle.__init__
 
-    task: object
-
-Register a new task in asyncio as executed by loop.
+    callback: object
+    args as callback_args: object
+    loop: object
+    context: object = None
 
-Returns None.
+Object returned by callback registration methods.
 [clinic start generated code]*/
 
-static PyObject *
-_asyncio__register_task_impl(PyObject *module, PyObject *task)
-/*[clinic end generated code: output=8672dadd69a7d4e2 input=21075aaea14dfbad]*/
+static int
+_asyncio_Handle___init___impl(HandleObj *self, PyObject *callback,
+                              PyObject *callback_args, PyObject *loop,
+                              PyObject *context)
+/*[clinic end generated code: output=a6fd445f3dd461ba input=2f5e00dd6750c23d]*/
 {
-    if (register_task(task) < 0) {
-        return NULL;
-    }
-    Py_RETURN_NONE;
+    return handle_init(self, callback, callback_args, loop, context, -1);
 }
 
-
 /*[clinic input]
-_asyncio._unregister_task
-
-    task: object
-
-Unregister a task.
-
-Returns None.
+_asyncio.Handle.cancel
 [clinic start generated code]*/
 
 static PyObject *
-_asyncio__unregister_task_impl(PyObject *module, PyObject *task)
-/*[clinic end generated code: output=6e5585706d568a46 input=28fb98c3975f7bdc]*/
+_asyncio_Handle_cancel_impl(HandleObj *self)
+/*[clinic end generated code: output=ddb39234782aab82 input=eaa3eb93236f622f]*/
 {
-    if (unregister_task(task) < 0) {
+    ENSURE_HANDLE_INITIALIZED(self)
+
+    if (handle_cancel(self) < 0) {
         return NULL;
     }
     Py_RETURN_NONE;
 }
 
-
 /*[clinic input]
-_asyncio._enter_task
-
-    loop: object
-    task: object
-
-Enter into task execution or resume suspended task.
-
-Task belongs to loop.
-
-Returns None.
+_asyncio.Handle.cancelled
 [clinic start generated code]*/
 
 static PyObject *
-_asyncio__enter_task_impl(PyObject *module, PyObject *loop, PyObject *task)
-/*[clinic end generated code: output=a22611c858035b73 input=de1b06dca70d8737]*/
+_asyncio_Handle_cancelled_impl(HandleObj *self)
+/*[clinic end generated code: output=0f4ad57f569e9f24 input=14a55098bea1b40a]*/
 {
-    if (enter_task(loop, task) < 0) {
-        return NULL;
-    }
-    Py_RETURN_NONE;
+    return PyBool_FromLong(self->h_cancelled);
 }
 
-
 /*[clinic input]
-_asyncio._leave_task
+_asyncio.Handle._run
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_Handle__run_impl(HandleObj *self)
+/*[clinic end generated code: output=1b186b710881500a input=94fc71ae0ddc7106]*/
+{
+    _Py_IDENTIFIER(call_exception_handler);
+    _Py_IDENTIFIER(message);
+    _Py_IDENTIFIER(exception);
+    _Py_IDENTIFIER(handle);
+    _Py_IDENTIFIER(source_traceback);
+
+    PyObject *et, *ev, *tb;
+    PyObject *context = NULL;
+    PyObject *cb = NULL;
+    PyObject *message = NULL;
+    PyObject *res;
+
+    ENSURE_HANDLE_INITIALIZED(self)
+
+    res = handle_call(self);
+    if (res != NULL) {
+        Py_DECREF(res);
+        Py_RETURN_NONE;
+    }
+    if (PyErr_ExceptionMatches(PyExc_SystemExit) ||
+        PyErr_ExceptionMatches(PyExc_KeyboardInterrupt)) {
+        return NULL;
+    }
+
+    PyErr_Fetch(&et, &ev, &tb);
+    PyErr_NormalizeException(&et, &ev, &tb);
+    if (tb != NULL) {
+        PyException_SetTraceback(ev, tb);
+    }
+
+    cb = PyObject_CallFunctionObjArgs(asyncio_format_callback_source_func,
+                                      none_if_null(self->h_callback),
+                                      none_if_null(self->h_args), NULL);
+    if (cb == NULL) {
+        goto finally;
+    }
+    message = PyUnicode_FromFormat("Exception in callback %S", cb);
+    if (message == NULL) {
+        goto finally;
+    }
+    context = PyDict_New();
+    if (context == NULL) {
+        goto finally;
+    }
+    if (_PyDict_SetItemId(context, &PyId_message, message) < 0 ||
+        _PyDict_SetItemId(context, &PyId_exception, ev) < 0 ||
+        _PyDict_SetItemId(context, &PyId_handle, (PyObject *)self) < 0) {
+        goto finally;
+    }
+    if (self->h_source_tb != NULL) {
+        int is_true = PyObject_IsTrue(self->h_source_tb);
+        if (is_true < 0) {
+            goto finally;
+        }
+        if (is_true &&
+            _PyDict_SetItemId(context, &PyId_source_traceback,
+                              self->h_source_tb) < 0) {
+            goto finally;
+        }
+    }
+
+    res = _PyObject_CallMethodIdOneArg(self->h_loop,
+                                       &PyId_call_exception_handler,
+                                       context);
+    if (res != NULL) {
+        Py_DECREF(res);
+        res = Py_None;
+        Py_INCREF(res);
+    }
+
+finally:
+    Py_XDECREF(context);
+    Py_XDECREF(message);
+    Py_XDECREF(cb);
+    Py_XDECREF(et);
+    Py_XDECREF(ev);
+    Py_XDECREF(tb);
+    return res;
+}
+
+/*[clinic input]
+_asyncio.Handle._repr_info
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_Handle__repr_info_impl(HandleObj *self)
+/*[clinic end generated code: output=7838b12075048d03 input=dba1c0a083077d57]*/
+{
+    return handle_repr_info(self);
+}
+
+static PyObject *
+HandleObj_repr(HandleObj *h)
+{
+    _Py_IDENTIFIER(_repr_info);
+
+    if (h->h_repr != NULL && h->h_repr != Py_None) {
+        Py_INCREF(h->h_repr);
+        return h->h_repr;
+    }
+
+    PyObject *rinfo = _PyObject_CallMethodIdNoArgs((PyObject*)h,
+                                                   &PyId__repr_info);
+    if (rinfo == NULL) {
+        return NULL;
+    }
+
+    PyObject *rinfo_s = PyUnicode_Join(NULL, rinfo);
+    Py_DECREF(rinfo);
+    if (rinfo_s == NULL) {
+        return NULL;
+    }
+
+    PyObject *rstr = PyUnicode_FromFormat("<%U>", rinfo_s);
+    Py_DECREF(rinfo_s);
+    return rstr;
+}
+
+static int
+HandleObj_clear(HandleObj *h)
+{
+    Py_CLEAR(h->h_callback);
+    Py_CLEAR(h->h_args);
+    Py_CLEAR(h->h_loop);
+    Py_CLEAR(h->h_context);
+    Py_CLEAR(h->h_source_tb);
+    Py_CLEAR(h->h_repr);
+    return 0;
+}
+
+static int
+HandleObj_traverse(HandleObj *h, visitproc visit, void *arg)
+{
+    Py_VISIT(h->h_callback);
+    Py_VISIT(h->h_args);
+    Py_VISIT(h->h_loop);
+    Py_VISIT(h->h_context);
+    Py_VISIT(h->h_source_tb);
+    Py_VISIT(h->h_repr);
+    return 0;
+}
+
+static void
+HandleObj_dealloc(PyObject *self)
+{
+    HandleObj *h = (HandleObj *)self;
+
+    PyObject_GC_UnTrack(self);
+
+    if (h->h_weakreflist != NULL) {
+        PyObject_ClearWeakRefs(self);
+    }
+
+    (void)HandleObj_clear(h);
+    Py_TYPE(h)->tp_free(h);
+}
+
+static PyMethodDef HandleType_methods[] = {
+    _ASYNCIO_HANDLE_CANCEL_METHODDEF
+    _ASYNCIO_HANDLE_CANCELLED_METHODDEF
+    _ASYNCIO_HANDLE__RUN_METHODDEF
+    _ASYNCIO_HANDLE__REPR_INFO_METHODDEF
+    {NULL, NULL}        /* Sentinel */
+};
+
+static PyMemberDef HandleType_members[] = {
+    {"_callback", T_OBJECT, offsetof(HandleObj, h_callback), 0},
+    {"_args", T_OBJECT, offsetof(HandleObj, h_args), 0},
+    {"_cancelled", T_BOOL, offsetof(HandleObj, h_cancelled), 0},
+    {"_loop", T_OBJECT, offsetof(HandleObj, h_loop), 0},
+    {"_source_traceback", T_OBJECT, offsetof(HandleObj, h_source_tb), 0},
+    {"_repr", T_OBJECT, offsetof(HandleObj, h_repr), 0},
+    {"_context", T_OBJECT, offsetof(HandleObj, h_context), 0},
+    {NULL} /* Sentinel */
+};
+
+static PyTypeObject HandleType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "_asyncio.Handle",
+    sizeof(HandleObj),                       /* tp_basicsize */
+    .tp_dealloc = HandleObj_dealloc,
+    .tp_repr = (reprfunc)HandleObj_repr,
+    .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_BASETYPE,
+    .tp_doc = _asyncio_Handle___init____doc__,
+    .tp_traverse = (traverseproc)HandleObj_traverse,
+    .tp_clear = (inquiry)HandleObj_clear,
+    .tp_weaklistoffset = offsetof(HandleObj, h_weakreflist),
+    .tp_methods = HandleType_methods,
+    .tp_members = HandleType_members,
+    .tp_init = (initproc)_asyncio_Handle___init__,
+    .tp_new = PyType_GenericNew,
+};
+
+
+/*********************** TimerHandle **************************/
+
+
+static int
+timer_handle_eq(TimerHandleObj *a, TimerHandleObj *b)
+{
+    int res;
+
+    res = PyObject_RichCompareBool(none_if_null(a->th_when),
+                                   none_if_null(b->th_when), Py_EQ);
+    if (res <= 0) {
+        return res;
+    }
+    res = PyObject_RichCompareBool(none_if_null(a->h_callback),
+                                   none_if_null(b->h_callback), Py_EQ);
+    if (res <= 0) {
+        return res;
+    }
+    res = PyObject_RichCompareBool(none_if_null(a->h_args),
+                                   none_if_null(b->h_args), Py_EQ);
+    if (res <= 0) {
+        return res;
+    }
+    return a->h_cancelled == b->h_cancelled;
+}
+
+/*[clinic input]
+_asyncio.TimerHandle.__init__
+
+    when: object
+    callback: object
+    args as callback_args: object
+    loop: object
+    context: object = None
+
+Object returned by timed callback registration methods.
+[clinic start generated code]*/
+
+static int
+_asyncio_TimerHandle___init___impl(TimerHandleObj *self, PyObject *when,
+                                   PyObject *callback,
+                                   PyObject *callback_args, PyObject *loop,
+                                   PyObject *context)
+/*[clinic end generated code: output=15759937528ba819 input=7354f2bd261e1296]*/
+{
+    if (when == Py_None) {
+        PyErr_SetNone(PyExc_AssertionError);
+        return -1;
+    }
+    if (handle_init((HandleObj *)self, callback, callback_args,
+                    loop, context, -1) < 0) {
+        return -1;
+    }
+    Py_INCREF(when);
+    Py_XSETREF(self->th_when, when);
+    self->th_scheduled = 0;
+    return 0;
+}
+
+/*[clinic input]
+_asyncio.TimerHandle.cancel
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_TimerHandle_cancel_impl(TimerHandleObj *self)
+/*[clinic end generated code: output=315df6426e6662ff input=529996fd507bb125]*/
+{
+    _Py_IDENTIFIER(_timer_handle_cancelled);
+
+    ENSURE_HANDLE_INITIALIZED(self)
+
+    if (!self->h_cancelled) {
+        PyObject *res = _PyObject_CallMethodIdOneArg(
+            self->h_loop, &PyId__timer_handle_cancelled, (PyObject *)self);
+        if (res == NULL) {
+            return NULL;
+        }
+        Py_DECREF(res);
+    }
+    if (handle_cancel((HandleObj *)self) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+_asyncio.TimerHandle.when
+
+Return a scheduled callback time.
+
+The time is an absolute timestamp, using the same time
+reference as loop.time().
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_TimerHandle_when_impl(TimerHandleObj *self)
+/*[clinic end generated code: output=cab0e5577e51b3af input=de801fd191075931]*/
+{
+    PyObject *when = none_if_null(self->th_when);
+    Py_INCREF(when);
+    return when;
+}
+
+/*[clinic input]
+_asyncio.TimerHandle._repr_info
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_TimerHandle__repr_info_impl(TimerHandleObj *self)
+/*[clinic end generated code: output=40e332eea82788b7 input=0ea1c37005c8bd50]*/
+{
+    PyObject *info, *item;
+
+    info = handle_repr_info((HandleObj *)self);
+    if (info == NULL) {
+        return NULL;
+    }
+    item = PyUnicode_FromFormat("when=%S", none_if_null(self->th_when));
+    if (item == NULL) {
+        Py_DECREF(info);
+        return NULL;
+    }
+    if (PyList_Insert(info, self->h_cancelled ? 2 : 1, item) < 0) {
+        Py_DECREF(item);
+        Py_DECREF(info);
+        return NULL;
+    }
+    Py_DECREF(item);
+    return info;
+}
+
+static PyObject *
+TimerHandleObj_richcompare(TimerHandleObj *self, PyObject *other, int op)
+{
+    TimerHandleObj *o;
+    int res;
+
+    if (!TimerHandle_Check(other)) {
+        Py_RETURN_NOTIMPLEMENTED;
+    }
+    o = (TimerHandleObj *)other;
+
+    switch (op) {
+    case Py_LT:
+    case Py_GT:
+        return PyObject_RichCompare(none_if_null(self->th_when),
+                                    none_if_null(o->th_when), op);
+    case Py_LE:
+    case Py_GE:
+        res = PyObject_RichCompareBool(none_if_null(self->th_when),
+                                       none_if_null(o->th_when),
+                                       op == Py_LE ? Py_LT : Py_GT);
+        if (res == 0) {
+            res = timer_handle_eq(self, o);
+        }
+        break;
+    case Py_EQ:
+        res = timer_handle_eq(self, o);
+        break;
+    case Py_NE:
+        res = timer_handle_eq(self, o);
+        if (res >= 0) {
+            res = !res;
+        }
+        break;
+    default:
+        Py_RETURN_NOTIMPLEMENTED;
+    }
+    if (res < 0) {
+        return NULL;
+    }
+    return PyBool_FromLong(res);
+}
+
+static Py_hash_t
+TimerHandleObj_hash(TimerHandleObj *self)
+{
+    return PyObject_Hash(none_if_null(self->th_when));
+}
+
+static int
+TimerHandleObj_clear(TimerHandleObj *th)
+{
+    Py_CLEAR(th->th_when);
+    return HandleObj_clear((HandleObj *)th);
+}
+
+static int
+TimerHandleObj_traverse(TimerHandleObj *th, visitproc visit, void *arg)
+{
+    Py_VISIT(th->th_when);
+    return HandleObj_traverse((HandleObj *)th, visit, arg);
+}
+
+static void
+TimerHandleObj_dealloc(PyObject *self)
+{
+    TimerHandleObj *th = (TimerHandleObj *)self;
+
+    PyObject_GC_UnTrack(self);
+
+    if (th->h_weakreflist != NULL) {
+        PyObject_ClearWeakRefs(self);
+    }
+
+    (void)TimerHandleObj_clear(th);
+    Py_TYPE(th)->tp_free(th);
+}
+
+static PyMethodDef TimerHandleType_methods[] = {
+    _ASYNCIO_TIMERHANDLE_CANCEL_METHODDEF
+    _ASYNCIO_TIMERHANDLE_WHEN_METHODDEF
+    _ASYNCIO_TIMERHANDLE__REPR_INFO_METHODDEF
+    {NULL, NULL}        /* Sentinel */
+};
+
+static PyMemberDef TimerHandleType_members[] = {
+    {"_when", T_OBJECT, offsetof(TimerHandleObj, th_when), 0},
+    {"_scheduled", T_BOOL, offsetof(TimerHandleObj, th_scheduled), 0},
+    {NULL} /* Sentinel */
+};
+
+static PyTypeObject TimerHandleType = {
+    PyVarObject_HEAD_INIT(NULL, 0)
+    "_asyncio.TimerHandle",
+    sizeof(TimerHandleObj),                  /* tp_basicsize */
+    .tp_base = &HandleType,
+    .tp_dealloc = TimerHandleObj_dealloc,
+    .tp_repr = (reprfunc)HandleObj_repr,
+    .tp_hash = (hashfunc)TimerHandleObj_hash,
+    .tp_flags = Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_GC | Py_TPFLAGS_BASETYPE,
+    .tp_doc = _asyncio_TimerHandle___init____doc__,
+    .tp_traverse = (traverseproc)TimerHandleObj_traverse,
+    .tp_clear = (inquiry)TimerHandleObj_clear,
+    .tp_richcompare = (richcmpfunc)TimerHandleObj_richcompare,
+    .tp_weaklistoffset = offsetof(TimerHandleObj, h_weakreflist),
+    .tp_methods = TimerHandleType_methods,
+    .tp_members = TimerHandleType_members,
+    .tp_init = (initproc)_asyncio_TimerHandle___init__,
+    .tp_new = PyType_GenericNew,
+};
+
+
+/*********************** Event loop **************************/
+
+/* Native versions of the hot BaseEventLoop methods.  asyncio.base_events
+   installs them on the class in place of the pure-Python ones (see
+   _asyncio._base_event_loop_methods()), so they must behave the same,
+   including for subclasses and for handles implemented in Python. */
+
+/* Keep in sync with asyncio/base_events.py. */
+#define MIN_SCHEDULED_TIMER_HANDLES 100
+#define MIN_CANCELLED_TIMER_HANDLES_FRACTION 0.5
+#define MAXIMUM_SELECT_TIMEOUT (24 * 3600)
+
+_Py_IDENTIFIER(_debug);
+_Py_IDENTIFIER(_ready);
+_Py_IDENTIFIER(_scheduled);
+_Py_IDENTIFIER(_timer_cancelled_count);
+_Py_IDENTIFIER(append);
+_Py_IDENTIFIER(time);
+
+/*[clinic input]
+class _asyncio.BaseEventLoop "PyObject *" "NULL"
+[clinic start generated code]*/
+/*[clinic end generated code: output=da39a3ee5e6b4b0d input=1720503a11a27e23]*/
+
+static int
+loop_get_debug(PyObject *loop)
+{
+    PyObject *debug = _PyObject_GetAttrId(loop, &PyId__debug);
+    if (debug == NULL) {
+        return -1;
+    }
+    int is_true = PyObject_IsTrue(debug);
+    Py_DECREF(debug);
+    return is_true;
+}
+
+static int
+loop_handle_cancelled(PyObject *handle)
+{
+    _Py_IDENTIFIER(_cancelled);
+
+    if (Handle_CheckExact(handle) || TimerHandle_CheckExact(handle)) {
+        return ((HandleObj *)handle)->h_cancelled;
+    }
+    PyObject *cancelled = _PyObject_GetAttrId(handle, &PyId__cancelled);
+    if (cancelled == NULL) {
+        return -1;
+    }
+    int is_true = PyObject_IsTrue(cancelled);
+    Py_DECREF(cancelled);
+    return is_true;
+}
+
+static PyObject *
+loop_timer_when(PyObject *timer)
+{
+    _Py_IDENTIFIER(_when);
+
+    if (TimerHandle_CheckExact(timer)) {
+        PyObject *when = none_if_null(((TimerHandleObj *)timer)->th_when);
+        Py_INCREF(when);
+        return when;
+    }
+    return _PyObject_GetAttrId(timer, &PyId__when);
+}
+
+/* Pop the first timer of the heap and mark it as no longer scheduled. */
+static PyObject *
+loop_timer_pop(PyObject *scheduled)
+{
+    PyObject *timer = PyObject_CallOneArg(heapq_heappop, scheduled);
+    if (timer == NULL) {
+        return NULL;
+    }
+    if (TimerHandle_CheckExact(timer)) {
+        ((TimerHandleObj *)timer)->th_scheduled = 0;
+    }
+    else if (_PyObject_SetAttrId(timer, &PyId__scheduled, Py_False) < 0) {
+        Py_DECREF(timer);
+        return NULL;
+    }
+    return timer;
+}
+
+static PyObject *
+loop_get_scheduled(PyObject *loop)
+{
+    PyObject *scheduled = _PyObject_GetAttrId(loop, &PyId__scheduled);
+    if (scheduled != NULL && !PyList_Check(scheduled)) {
+        PyErr_Format(PyExc_TypeError,
+                     "_scheduled must be a list, not %.200s",
+                     Py_TYPE(scheduled)->tp_name);
+        Py_CLEAR(scheduled);
+    }
+    return scheduled;
+}
+
+static PyObject *
+loop_new_handle(PyObject *loop, PyObject *callback, PyObject *args,
+                PyObject *context, int debug)
+{
+    PyObject *ready, *res;
+    HandleObj *handle;
+
+    handle = (HandleObj *)HandleType.tp_alloc(&HandleType, 0);
+    if (handle == NULL) {
+        return NULL;
+    }
+    if (handle_init(handle, callback, args, loop, context, debug) < 0) {
+        goto error;
+    }
+    ready = _PyObject_GetAttrId(loop, &PyId__ready);
+    if (ready == NULL) {
+        goto error;
+    }
+    res = _PyObject_CallMethodIdOneArg(ready, &PyId_append,
+                                       (PyObject *)handle);
+    Py_DECREF(ready);
+    if (res == NULL) {
+        goto error;
+    }
+    Py_DECREF(res);
+    return (PyObject *)handle;
+
+error:
+    Py_DECREF(handle);
+    return NULL;
+}
+
+PyDoc_STRVAR(_asyncio_BaseEventLoop_call_soon__doc__,
+"call_soon($self, callback, /, *args, context=None)\n"
+"--\n"
+"\n"
+"Arrange for a callback to be called as soon as possible.\n"
+"\n"
+"This operates as a FIFO queue: callbacks are called in the\n"
+"order in which they are registered.  Each callback will be\n"
+"called exactly once.\n"
+"\n"
+"Any positional arguments after the callback will be passed to\n"
+"the callback when it is called.");
+
+/* Argument Clinic cannot express *args, so this one is parsed by hand. */
+static PyObject *
+_asyncio_BaseEventLoop_call_soon(PyObject *loop, PyObject *const *args,
+                                 Py_ssize_t nargs, PyObject *kwnames)
+{
+    _Py_IDENTIFIER(_closed);
+    _Py_IDENTIFIER(_check_thread);
+    _Py_IDENTIFIER(_check_callback);
+
+    PyObject *callback, *callback_args, *context = Py_None;
+    PyObject *res, *handle;
+    int is_true, debug;
+
+    if (nargs < 1) {
+        PyErr_SetString(PyExc_TypeError,
+                        "call_soon() missing required argument "
+                        "'callback' (pos 1)");
+        return NULL;
+    }
+    if (kwnames != NULL) {
+        for (Py_ssize_t i = 0; i < PyTuple_GET_SIZE(kwnames); i++) {
+            PyObject *key = PyTuple_GET_ITEM(kwnames, i);
+            if (!_PyUnicode_EqualToASCIIString(key, "context")) {
+                PyErr_Format(PyExc_TypeError,
+                             "call_soon() got an unexpected keyword "
+                             "argument '%S'", key);
+                return NULL;
+            }
+            context = args[nargs + i];
+        }
+    }
+    callback = args[0];
+
+    res = _PyObject_GetAttrId(loop, &PyId__closed);
+    if (res == NULL) {
+        return NULL;
+    }
+    is_true = PyObject_IsTrue(res);
+    Py_DECREF(res);
+    if (is_true < 0) {
+        return NULL;
+    }
+    if (is_true) {
+        PyErr_SetString(PyExc_RuntimeError, "Event loop is closed");
+        return NULL;
+    }
+
+    debug = loop_get_debug(loop);
+    if (debug < 0) {
+        return NULL;
+    }
+    if (debug) {
+        res = _PyObject_CallMethodIdNoArgs(loop, &PyId__check_thread);
+        if (res == NULL) {
+            return NULL;
+        }
+        Py_DECREF(res);
+        res = _PyObject_CallMethodId(loop, &PyId__check_callback, "Os",
+                                     callback, "call_soon");
+        if (res == NULL) {
+            return NULL;
+        }
+        Py_DECREF(res);
+    }
+
+    callback_args = PyTuple_New(nargs - 1);
+    if (callback_args == NULL) {
+        return NULL;
+    }
+    for (Py_ssize_t i = 1; i < nargs; i++) {
+        Py_INCREF(args[i]);
+        PyTuple_SET_ITEM(callback_args, i - 1, args[i]);
+    }
+    /* There is no Python frame for this function, so the source traceback
+       already ends at the caller and needs no trimming. */
+    handle = loop_new_handle(loop, callback, callback_args, context, debug);
+    Py_DECREF(callback_args);
+    return handle;
+}
+
+#define _ASYNCIO_BASEEVENTLOOP_CALL_SOON_METHODDEF    \
+    {"call_soon", (PyCFunction)(void(*)(void))_asyncio_BaseEventLoop_call_soon, \
+     METH_FASTCALL|METH_KEYWORDS, _asyncio_BaseEventLoop_call_soon__doc__},
+
+/*[clinic input]
+_asyncio.BaseEventLoop._call_soon
+
+    callback: object
+    args as callback_args: object
+    context: object
+    /
+
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_BaseEventLoop__call_soon_impl(PyObject *self, PyObject *callback,
+                                       PyObject *callback_args,
+                                       PyObject *context)
+/*[clinic end generated code: output=c31576a8fca8d085 input=72645c626922f598]*/
+
+{
+    return loop_new_handle(self, callback, callback_args, context, -1);
+}
+
+/* Remove cancelled timers: all of them if they make up too large a share
+   of the heap, otherwise just the ones at its head.  On success *scheduled
+   is the loop's current heap. */
+static int
+loop_purge_cancelled(PyObject *loop, PyObject **scheduled)
+{
+    PyObject *heap = *scheduled;
+    PyObject *count, *res;
+    Py_ssize_t sched_count = PyList_GET_SIZE(heap);
+
+    if (sched_count > MIN_SCHEDULED_TIMER_HANDLES) {
+        count = _PyObject_GetAttrId(loop, &PyId__timer_cancelled_count);
+        if (count == NULL) {
+            return -1;
+        }
+        double ncancelled = PyFloat_AsDouble(count);
+        Py_DECREF(count);
+        if (ncancelled == -1.0 && PyErr_Occurred()) {
+            return -1;
+        }
+        if (ncancelled / sched_count > MIN_CANCELLED_TIMER_HANDLES_FRACTION) {
+            PyObject *new_scheduled = PyList_New(0);
+            if (new_scheduled == NULL) {
+                return -1;
+            }
+            for (Py_ssize_t i = 0; i < PyList_GET_SIZE(heap); i++) {
+                PyObject *timer = PyList_GET_ITEM(heap, i);
+                int cancelled;
+
+                Py_INCREF(timer);
+                cancelled = loop_handle_cancelled(timer);
+                if (cancelled > 0) {
+                    if (TimerHandle_CheckExact(timer)) {
+                        ((TimerHandleObj *)timer)->th_scheduled = 0;
+                    }
+                    else if (_PyObject_SetAttrId(timer, &PyId__scheduled,
+                                                 Py_False) < 0) {
+                        cancelled = -1;
+                    }
+                }
+                else if (cancelled == 0) {
+                    cancelled = PyList_Append(new_scheduled, timer);
+                }
+                Py_DECREF(timer);
+                if (cancelled < 0) {
+                    Py_DECREF(new_scheduled);
+                    return -1;
+                }
+            }
+
+            res = PyObject_CallOneArg(heapq_heapify, new_scheduled);
+            if (res == NULL ||
+                _PyObject_SetAttrId(loop, &PyId__scheduled,
+                                    new_scheduled) < 0) {
+                Py_XDECREF(res);
+                Py_DECREF(new_scheduled);
+                return -1;
+            }
+            Py_DECREF(res);
+            Py_SETREF(*scheduled, new_scheduled);
+
+            count = PyLong_FromLong(0);
+            if (count == NULL) {
+                return -1;
+            }
+            int rc = _PyObject_SetAttrId(loop, &PyId__timer_cancelled_count,
+                                         count);
+            Py_DECREF(count);
+            return rc;
+        }
+    }
+
+    while (PyList_GET_SIZE(heap) > 0) {
+        PyObject *timer = PyList_GET_ITEM(heap, 0);
+        int cancelled;
+
+        Py_INCREF(timer);
+        cancelled = loop_handle_cancelled(timer);
+        Py_DECREF(timer);
+        if (cancelled <= 0) {
+            return cancelled;
+        }
+
+        count = _PyObject_GetAttrId(loop, &PyId__timer_cancelled_count);
+        if (count == NULL) {
+            return -1;
+        }
+        Py_SETREF(count, PyNumber_Subtract(count, _PyLong_GetOne()));
+        if (count == NULL) {
+            return -1;
+        }
+        int rc = _PyObject_SetAttrId(loop, &PyId__timer_cancelled_count,
+                                     count);
+        Py_DECREF(count);
+        if (rc < 0) {
+            return -1;
+        }
+
+        timer = loop_timer_pop(heap);
+        if (timer == NULL) {
+            return -1;
+        }
+        Py_DECREF(timer);
+    }
+    return 0;
+}
+
+/* min(max(0, timer._when - loop.time()), MAXIMUM_SELECT_TIMEOUT) */
+static PyObject *
+loop_select_timeout(PyObject *loop, PyObject *timer)
+{
+    PyObject *when, *now, *timeout, *bound;
+    int cmp;
+
+    when = loop_timer_when(timer);
+    if (when == NULL) {
+        return NULL;
+    }
+    now = _PyObject_CallMethodIdNoArgs(loop, &PyId_time);
+    if (now == NULL) {
+        Py_DECREF(when);
+        return NULL;
+    }
+    timeout = PyNumber_Subtract(when, now);
+    Py_DECREF(when);
+    Py_DECREF(now);
+    if (timeout == NULL) {
+        return NULL;
+    }
+
+    bound = PyLong_FromLong(0);
+    if (bound == NULL) {
+        goto error;
+    }
+    cmp = PyObject_RichCompareBool(timeout, bound, Py_GT);
+    if (cmp < 0) {
+        goto error;
+    }
+    if (cmp == 0) {
+        Py_SETREF(timeout, bound);
+    }
+    else {
+        Py_DECREF(bound);
+    }
+
+    bound = PyLong_FromLong(MAXIMUM_SELECT_TIMEOUT);
+    if (bound == NULL) {
+        goto error;
+    }
+    cmp = PyObject_RichCompareBool(bound, timeout, Py_LT);
+    if (cmp < 0) {
+        goto error;
+    }
+    if (cmp > 0) {
+        Py_SETREF(timeout, bound);
+    }
+    else {
+        Py_DECREF(bound);
+    }
+    return timeout;
+
+error:
+    Py_XDECREF(bound);
+    Py_DECREF(timeout);
+    return NULL;
+}
+
+static PyObject *
+loop_run_handle(PyObject *handle)
+{
+    _Py_IDENTIFIER(_run);
+
+    if (Handle_CheckExact(handle) || TimerHandle_CheckExact(handle)) {
+        return _asyncio_Handle__run_impl((HandleObj *)handle);
+    }
+    return _PyObject_CallMethodIdNoArgs(handle, &PyId__run);
+}
+
+static int
+loop_warn_slow_callback(PyObject *handle, PyObject *dt)
+{
+    _Py_IDENTIFIER(logger);
+    _Py_IDENTIFIER(_format_handle);
+    _Py_IDENTIFIER(warning);
+
+    PyObject *module, *logger = NULL, *format_handle, *text, *res;
+
+    module = PyImport_ImportModule("asyncio.base_events");
+    if (module == NULL) {
+        return -1;
+    }
+    format_handle = _PyObject_GetAttrId(module, &PyId__format_handle);
+    if (format_handle != NULL) {
+        logger = _PyObject_GetAttrId(module, &PyId_logger);
+    }
+    Py_DECREF(module);
+    if (logger == NULL) {
+        Py_XDECREF(format_handle);
+        return -1;
+    }
+
+    text = PyObject_CallOneArg(format_handle, handle);
+    Py_DECREF(format_handle);
+    if (text == NULL) {
+        Py_DECREF(logger);
+        return -1;
+    }
+    res = _PyObject_CallMethodId(logger, &PyId_warning, "sOO",
+                                 "Executing %s took %.3f seconds", text, dt);
+    Py_DECREF(text);
+    Py_DECREF(logger);
+    if (res == NULL) {
+        return -1;
+    }
+    Py_DECREF(res);
+    return 0;
+}
+
+/* Run a handle in debug mode: expose it as loop._current_handle and warn
+   if it takes longer than loop.slow_callback_duration. */
+static int
+loop_run_handle_debug(PyObject *loop, PyObject *handle)
+{
+    _Py_IDENTIFIER(_current_handle);
+    _Py_IDENTIFIER(slow_callback_duration);
+
+    PyObject *t0 = NULL, *t1 = NULL, *dt = NULL, *slow = NULL, *res;
+    PyObject *et, *ev, *tb;
+    int rc = -1;
+
+    if (_PyObject_SetAttrId(loop, &PyId__current_handle, handle) < 0) {
+        goto finally;
+    }
+    t0 = _PyObject_CallMethodIdNoArgs(loop, &PyId_time);
+    if (t0 == NULL) {
+        goto finally;
+    }
+    res = loop_run_handle(handle);
+    if (res == NULL) {
+        goto finally;
+    }
+    Py_DECREF(res);
+    t1 = _PyObject_CallMethodIdNoArgs(loop, &PyId_time);
+    if (t1 == NULL) {
+        goto finally;
+    }
+    dt = PyNumber_Subtract(t1, t0);
+    if (dt == NULL) {
+        goto finally;
+    }
+    slow = _PyObject_GetAttrId(loop, &PyId_slow_callback_duration);
+    if (slow == NULL) {
+        goto finally;
+    }
+    int is_slow = PyObject_RichCompareBool(dt, slow, Py_GE);
+    if (is_slow < 0 ||
+        (is_slow && loop_warn_slow_callback(handle, dt) < 0)) {
+        goto finally;
+    }
+    rc = 0;
+
+finally:
+    PyErr_Fetch(&et, &ev, &tb);
+    if (_PyObject_SetAttrId(loop, &PyId__current_handle, Py_None) < 0) {
+        _PyErr_ChainExceptions(et, ev, tb);
+        rc = -1;
+    }
+    else {
+        PyErr_Restore(et, ev, tb);
+    }
+    Py_XDECREF(t0);
+    Py_XDECREF(t1);
+    Py_XDECREF(dt);
+    Py_XDECREF(slow);
+    return rc;
+}
+
+/*[clinic input]
+_asyncio.BaseEventLoop._run_once
+
+Run one full iteration of the event loop.
+
+This calls all currently ready callbacks, polls for I/O,
+schedules the resulting callbacks, and finally schedules
+'call_later' callbacks.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_BaseEventLoop__run_once_impl(PyObject *self)
+/*[clinic end generated code: output=0954649161c86e4b input=ee491db01b1cea0a]*/
+
+{
+    _Py_IDENTIFIER(_stopping);
+    _Py_IDENTIFIER(_selector);
+    _Py_IDENTIFIER(select);
+    _Py_IDENTIFIER(_process_events);
+    _Py_IDENTIFIER(_clock_resolution);
+    _Py_IDENTIFIER(popleft);
+
+    PyObject *scheduled, *ready = NULL, *timeout = NULL, *popleft = NULL;
+    PyObject *end_time = NULL, *obj, *res;
+    Py_ssize_t ntodo;
+    int is_true;
+
+    scheduled = loop_get_scheduled(self);
+    if (scheduled == NULL) {
+        return NULL;
+    }
+    if (loop_purge_cancelled(self, &scheduled) < 0) {
+        goto error;
+    }
+
+    ready = _PyObject_GetAttrId(self, &PyId__ready);
+    if (ready == NULL) {
+        goto error;
+    }
+    is_true = PyObject_IsTrue(ready);
+    if (is_true == 0) {
+        obj = _PyObject_GetAttrId(self, &PyId__stopping);
+        if (obj == NULL) {
+            goto error;
+        }
+        is_true = PyObject_IsTrue(obj);
+        Py_DECREF(obj);
+    }
+    if (is_true < 0) {
+        goto error;
+    }
+    if (is_true) {
+        timeout = PyLong_FromLong(0);
+    }
+    else if (PyList_GET_SIZE(scheduled) > 0) {
+        obj = PyList_GET_ITEM(scheduled, 0);
+        Py_INCREF(obj);
+        timeout = loop_select_timeout(self, obj);
+        Py_DECREF(obj);
+    }
+    else {
+        timeout = Py_None;
+        Py_INCREF(timeout);
+    }
+    if (timeout == NULL) {
+        goto error;
+    }
+
+    obj = _PyObject_GetAttrId(self, &PyId__selector);
+    if (obj == NULL) {
+        goto error;
+    }
+    Py_SETREF(obj, _PyObject_CallMethodIdOneArg(obj, &PyId_select, timeout));
+    if (obj == NULL) {
+        goto error;
+    }
+    res = _PyObject_CallMethodIdOneArg(self, &PyId__process_events, obj);
+    Py_DECREF(obj);
+    if (res == NULL) {
+        goto error;
+    }
+    Py_DECREF(res);
+
+    /* Handle 'later' callbacks that are ready. */
+    obj = _PyObject_CallMethodIdNoArgs(self, &PyId_time);
+    if (obj == NULL) {
+        goto error;
+    }
+    res = _PyObject_GetAttrId(self, &PyId__clock_resolution);
+    if (res == NULL) {
+        Py_DECREF(obj);
+        goto error;
+    }
+    end_time = PyNumber_Add(obj, res);
+    Py_DECREF(obj);
+    Py_DECREF(res);
+    if (end_time == NULL) {
+        goto error;
+    }
+    Py_SETREF(scheduled, loop_get_scheduled(self));
+    if (scheduled == NULL) {
+        goto error;
+    }
+    Py_SETREF(ready, _PyObject_GetAttrId(self, &PyId__ready));
+    if (ready == NULL) {
+        goto error;
+    }
+    while (PyList_GET_SIZE(scheduled) > 0) {
+        obj = PyList_GET_ITEM(scheduled, 0);
+        Py_INCREF(obj);
+        Py_SETREF(obj, loop_timer_when(obj));
+        if (obj == NULL) {
+            goto error;
+        }
+        if (PyFloat_CheckExact(obj) && PyFloat_CheckExact(end_time)) {
+            is_true = PyFloat_AS_DOUBLE(obj) >= PyFloat_AS_DOUBLE(end_time);
+        }
+        else {
+            is_true = PyObject_RichCompareBool(obj, end_time, Py_GE);
+        }
+        Py_DECREF(obj);
+        if (is_true < 0) {
+            goto error;
+        }
+        if (is_true) {
+            break;
+        }
+        obj = loop_timer_pop(scheduled);
+        if (obj == NULL) {
+            goto error;
+        }
+        res = _PyObject_CallMethodIdOneArg(ready, &PyId_append, obj);
+        Py_DECREF(obj);
+        if (res == NULL) {
+            goto error;
+        }
+        Py_DECREF(res);
+    }
+
+    /* This is the only place where callbacks are actually *called*.
+       All other places just add them to ready.  Run all currently
+       scheduled callbacks, but not any callbacks scheduled by callbacks
+       run this time around -- they will be run the next time (after
+       another I/O poll). */
+    ntodo = PyObject_Size(ready);
+    if (ntodo < 0) {
+        goto error;
+    }
+    if (ntodo > 0) {
+        popleft = _PyObject_GetAttrId(ready, &PyId_popleft);
+        if (popleft == NULL) {
+            goto error;
+        }
+    }
+    for (Py_ssize_t i = 0; i < ntodo; i++) {
+        obj = PyObject_CallNoArgs(popleft);
+        if (obj == NULL) {
+            goto error;
+        }
+        is_true = loop_handle_cancelled(obj);
+        if (is_true == 0) {
+            is_true = loop_get_debug(self);
+            if (is_true > 0) {
+                is_true = loop_run_handle_debug(self, obj);
+            }
+            else if (is_true == 0) {
+                res = loop_run_handle(obj);
+                if (res == NULL) {
+                    is_true = -1;
+                }
+                Py_XDECREF(res);
+            }
+        }
+        Py_DECREF(obj);
+        if (is_true < 0) {
+            goto error;
+        }
+    }
+
+    Py_DECREF(scheduled);
+    Py_DECREF(ready);
+    Py_DECREF(timeout);
+    Py_DECREF(end_time);
+    Py_XDECREF(popleft);
+    Py_RETURN_NONE;
+
+error:
+    Py_XDECREF(scheduled);
+    Py_XDECREF(ready);
+    Py_XDECREF(timeout);
+    Py_XDECREF(end_time);
+    Py_XDECREF(popleft);
+    return NULL;
+}
+
+/*[clinic input]
+_asyncio._base_event_loop_methods
+
+    cls: object(subclass_of='&PyType_Type', type='PyTypeObject *')
+    /
+
+Return the native versions of hot BaseEventLoop methods.
+
+The result maps method names to method descriptors bound to cls.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__base_event_loop_methods_impl(PyObject *module, PyTypeObject *cls)
+/*[clinic end generated code: output=d6ef1d0df383785f input=6b5986f2f45727f7]*/
+
+{
+    static PyMethodDef methods[] = {
+        _ASYNCIO_BASEEVENTLOOP_CALL_SOON_METHODDEF
+        _ASYNCIO_BASEEVENTLOOP__CALL_SOON_METHODDEF
+        _ASYNCIO_BASEEVENTLOOP__RUN_ONCE_METHODDEF
+        {NULL, NULL}        /* Sentinel */
+    };
+
+    PyObject *result = PyDict_New();
+    if (result == NULL) {
+        return NULL;
+    }
+    for (PyMethodDef *def = methods; def->ml_name != NULL; def++) {
+        PyObject *descr = PyDescr_NewMethod(cls, def);
+        if (descr == NULL ||
+            PyDict_SetItemString(result, def->ml_name, descr) < 0) {
+            Py_XDECREF(descr);
+            Py_DECREF(result);
+            return NULL;
+        }
+        Py_DECREF(descr);
+    }
+    return result;
+}
+
+
+/*********************** Functions **************************/
+
+
+/*[clinic input]
+_asyncio._get_running_loop
+
+Return the running event loop or None.
+
+This is a low-level function intended to be used by event loops.
+This function is thread-specific.
+
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__get_running_loop_impl(PyObject *module)
+/*[clinic end generated code: output=b4390af721411a0a input=0a21627e25a4bd43]*/
+{
+    PyObject *loop;
+    if (get_running_loop(&loop)) {
+        return NULL;
+    }
+    if (loop == NULL) {
+        /* There's no currently running event loop */
+        Py_RETURN_NONE;
+    }
+    return loop;
+}
+
+/*[clinic input]
+_asyncio._set_running_loop
+    loop: 'O'
+    /
+
+Set the running event loop.
+
+This is a low-level function intended to be used by event loops.
+This function is thread-specific.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__set_running_loop(PyObject *module, PyObject *loop)
+/*[clinic end generated code: output=ae56bf7a28ca189a input=4c9720233d606604]*/
+{
+    if (set_running_loop(loop)) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+/*[clinic input]
+_asyncio.get_event_loop
+
+Return an asyncio event loop.
+
+When called from a coroutine or a callback (e.g. scheduled with
+call_soon or similar API), this function will always return the
+running event loop.
+
+If there is no running event loop set, the function will return
+the result of `get_event_loop_policy().get_event_loop()` call.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_get_event_loop_impl(PyObject *module)
+/*[clinic end generated code: output=2a2d8b2f824c648b input=9364bf2916c8655d]*/
+{
+    return get_event_loop();
+}
+
+/*[clinic input]
+_asyncio.get_running_loop
+
+Return the running event loop.  Raise a RuntimeError if there is none.
+
+This function is thread-specific.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio_get_running_loop_impl(PyObject *module)
+/*[clinic end generated code: output=c247b5f9e529530e input=2a3bf02ba39f173d]*/
+{
+    PyObject *loop;
+    if (get_running_loop(&loop)) {
+        return NULL;
+    }
+    if (loop == NULL) {
+        /* There's no currently running event loop */
+        PyErr_SetString(
+            PyExc_RuntimeError, "no running event loop");
+    }
+    return loop;
+}
+
+/*[clinic input]
+_asyncio._register_task
+
+    task: object
+
+Register a new task in asyncio as executed by loop.
+
+Returns None.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__register_task_impl(PyObject *module, PyObject *task)
+/*[clinic end generated code: output=8672dadd69a7d4e2 input=21075aaea14dfbad]*/
+{
+    if (register_task(task) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+
+/*[clinic input]
+_asyncio._unregister_task
+
+    task: object
+
+Unregister a task.
+
+Returns None.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__unregister_task_impl(PyObject *module, PyObject *task)
+/*[clinic end generated code: output=6e5585706d568a46 input=28fb98c3975f7bdc]*/
+{
+    if (unregister_task(task) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+
+/*[clinic input]
+_asyncio._enter_task
+
+    loop: object
+    task: object
+
+Enter into task execution or resume suspended task.
+
+Task belongs to loop.
+
+Returns None.
+[clinic start generated code]*/
+
+static PyObject *
+_asyncio__enter_task_impl(PyObject *module, PyObject *loop, PyObject *task)
+/*[clinic end generated code: output=a22611c858035b73 input=de1b06dca70d8737]*/
+{
+    if (enter_task(loop, task) < 0) {
+        return NULL;
+    }
+    Py_RETURN_NONE;
+}
+
+
+/*[clinic input]
+_asyncio._leave_task
 
     loop: object
     task: object
@@ -3270,8 +4894,12 @@ module_free(void *m)
     Py_CLEAR(asyncio_task_get_stack_func);
     Py_CLEAR(asyncio_task_print_stack_func);
     Py_CLEAR(asyncio_task_repr_info_func);
+    Py_CLEAR(asyncio_format_callback_source_func);
+    Py_CLEAR(asyncio_extract_stack_func);
     Py_CLEAR(asyncio_InvalidStateError);
     Py_CLEAR(asyncio_CancelledError);
+    Py_CLEAR(heapq_heappop);
+    Py_CLEAR(heapq_heapify);
 
     Py_CLEAR(all_tasks);
     Py_CLEAR(current_tasks);
@@ -3344,9 +4972,18 @@ module_init(void)
     GET_MOD_ATTR(asyncio_task_get_stack_func, "_task_get_stack")
     GET_MOD_ATTR(asyncio_task_print_stack_func, "_task_print_stack")
 
+    WITH_MOD("asyncio.format_helpers")
+    GET_MOD_ATTR(asyncio_format_callback_source_func,
+                 "_format_callback_source")
+    GET_MOD_ATTR(asyncio_extract_stack_func, "extract_stack")
+
     WITH_MOD("asyncio.coroutines")
     GET_MOD_ATTR(asyncio_iscoroutine_func, "iscoroutine")
 
+    WITH_MOD("heapq")
+    GET_MOD_ATTR(heapq_heappop, "heappop")
+    GET_MOD_ATTR(heapq_heapify, "heapify")
+
     WITH_MOD("traceback")
     GET_MOD_ATTR(traceback_extract_stack, "extract_stack")
 
@@ -3382,6 +5019,7 @@ static PyMethodDef asyncio_methods[] = {
     _ASYNCIO__UNREGISTER_TASK_METHODDEF
     _ASYNCIO__ENTER_TASK_METHODDEF
     _ASYNCIO__LEAVE_TASK_METHODDEF
+    _ASYNCIO__BASE_EVENT_LOOP_METHODS_METHODDEF
     {NULL, NULL}
 };
 
@@ -3419,7 +5057,8 @@ PyInit__asyncio(void)
         return NULL;
     }
 
-    /* FutureType and TaskType are made ready by PyModule_AddType() calls below. */
+    /* FutureType, TaskType, HandleType and TimerHandleType are made ready by
+       PyModule_AddType() calls below. */
     if (PyModule_AddType(m, &FutureType) < 0) {
         Py_DECREF(m);
         return NULL;
@@ -3430,6 +5069,16 @@ PyInit__asyncio(void)
         return NULL;
     }
 
+    if (PyModule_AddType(m, &HandleType) < 0) {
+        Py_DECREF(m);
+        return NULL;
+    }
+
+    if (PyModule_AddType(m, &TimerHandleType) < 0) {
+        Py_DECREF(m);
+        return NULL;
+    }
+
     Py_INCREF(all_tasks);
     if (PyModule_AddObject(m, "_all_tasks", all_tasks) < 0) {
         Py_DECREF(all_tasks);
@@ -610,6 +610,45 @@ parse_add_char(ReaderObj *self, _csvstate *module_state, Py_UCS4 c)
     return 0;
 }
 
+/* Copy the run of ordinary characters starting at data[pos] into the field
+   buffer at once.  Only used in the IN_FIELD and IN_QUOTED_FIELD states,
+   where such characters would simply be added one by one; the run stops
+   before any character parse_process_char() may treat specially.  Returns
+   the position following the run, or -1 on error. */
+static Py_ssize_t
+parse_add_run(ReaderObj *self, _csvstate *module_state,
+              int kind, const void *data, Py_ssize_t pos, Py_ssize_t linelen)
+{
+    DialectObj *dialect = self->dialect;
+    Py_UCS4 delimiter = dialect->delimiter;
+    Py_UCS4 quotechar = dialect->quotechar;
+    Py_UCS4 escapechar = dialect->escapechar;
+    Py_ssize_t end, i;
+
+    for (end = pos; end < linelen; end++) {
+        Py_UCS4 c = PyUnicode_READ(kind, data, end);
+        if (c == delimiter || c == quotechar || c == escapechar ||
+            c == '\n' || c == '\r' || c == '\0')
+            break;
+    }
+    if (end == pos)
+        return pos;
+
+    if (end - pos > module_state->field_limit - self->field_len) {
+        PyErr_Format(module_state->error_obj,
+                     "field larger than field limit (%ld)",
+                     module_state->field_limit);
+        return -1;
+    }
+    while (end - pos > self->field_size - self->field_len) {
+        if (!parse_grow_buff(self))
+            return -1;
+    }
+    for (i = pos; i < end; i++)
+        self->field[self->field_len++] = PyUnicode_READ(kind, data, i);
+    return end;
+}
+
 static int
 parse_process_char(ReaderObj *self, _csvstate *module_state, Py_UCS4 c)
 {
@@ -855,7 +894,17 @@ Reader_iternext(ReaderObj *self)
         data = PyUnicode_DATA(lineobj);
         pos = 0;
         linelen = PyUnicode_GET_LENGTH(lineobj);
-        while (linelen--) {
+        while (pos < linelen) {
+            if (self->state == IN_FIELD || self->state == IN_QUOTED_FIELD) {
+                pos = parse_add_run(self, module_state, kind, data,
+                                    pos, linelen);
+                if (pos < 0) {
+                    Py_DECREF(lineobj);
+                    goto err;
+                }
+                if (pos == linelen)
+                    break;
+            }
             c = PyUnicode_READ(kind, data, pos);
             if (c == '\0') {
                 Py_DECREF(lineobj);
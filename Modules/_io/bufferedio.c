@@ -13,6 +13,10 @@
 #include "structmember.h"         // PyMemberDef
 #include "_iomodule.h"
 
+#ifdef HAVE_SYS_UIO_H
+#include <sys/uio.h>
+#endif
+
 /*[clinic input]
 module _io
 class _io._BufferedIOBase "PyObject *" "&PyBufferedIOBase_Type"
@@ -1913,32 +1917,15 @@ _bufferedwriter_flush_unlocked(buffered *self)
     return NULL;
 }
 
-/*[clinic input]
-_io.BufferedWriter.write
-    buffer: Py_buffer
-    /
-[clinic start generated code]*/
-
-static PyObject *
-_io_BufferedWriter_write_impl(buffered *self, Py_buffer *buffer)
-/*[clinic end generated code: output=7f8d1365759bfc6b input=dd87dd85fc7f8850]*/
+/* Write the given data, with the lock held and the stream checked open.
+   Return the number of bytes written, or -1 with an exception set. */
+static Py_ssize_t
+_bufferedwriter_write_unlocked(buffered *self, Py_buffer *buffer)
 {
-    PyObject *res = NULL;
+    PyObject *res;
     Py_ssize_t written, avail, remaining;
     Py_off_t offset;
 
-    CHECK_INITIALIZED(self)
-
-    if (!ENTER_BUFFERED(self))
-        return NULL;
-
-    /* Issue #31976: Check for closed file after acquiring the lock. Another
-       thread could be holding the lock while closing the file. */
-    if (IS_CLOSED(self)) {
-        PyErr_SetString(PyExc_ValueError, "write to closed file");
-        goto error;
-    }
-
     /* Fast path: the data to write can be fully buffered. */
     if (!VALID_READ_BUFFER(self) && !VALID_WRITE_BUFFER(self)) {
         self->pos = 0;
@@ -1953,8 +1940,7 @@ _io_BufferedWriter_write_impl(buffered *self, Py_buffer *buffer)
         ADJUST_POSITION(self, self->pos + buffer->len);
         if (self->pos > self->write_end)
             self->write_end = self->pos;
-        written = buffer->len;
-        goto end;
+        return buffer->len;
     }
 
     /* First write the current buffer */
@@ -1962,7 +1948,7 @@ _io_BufferedWriter_write_impl(buffered *self, Py_buffer *buffer)
     if (res == NULL) {
         Py_ssize_t *w = _buffered_check_blocking_error();
         if (w == NULL)
-            goto error;
+            return -1;
         if (self->readable)
             _bufferedreader_reset_buf(self);
         /* Make some place by shifting the buffer. */
@@ -1982,8 +1968,7 @@ _io_BufferedWriter_write_impl(buffered *self, Py_buffer *buffer)
             memcpy(self->buffer + self->write_end, buffer->buf, buffer->len);
             self->write_end += buffer->len;
             self->pos += buffer->len;
-            written = buffer->len;
-            goto end;
+            return buffer->len;
         }
         /* Buffer as much as possible. */
         memcpy(self->buffer + self->write_end, buffer->buf, avail);
@@ -1994,7 +1979,7 @@ _io_BufferedWriter_write_impl(buffered *self, Py_buffer *buffer)
            Therefore we just replace with a new error. */
         _set_BlockingIOError("write could not complete without blocking",
                              avail);
-        goto error;
+        return -1;
     }
     Py_CLEAR(res);
 
@@ -2007,7 +1992,7 @@ _io_BufferedWriter_write_impl(buffered *self, Py_buffer *buffer)
     offset = RAW_OFFSET(self);
     if (offset != 0) {
         if (_buffered_raw_seek(self, -offset, 1) < 0)
-            goto error;
+            return -1;
         self->raw_pos -= offset;
     }
 
@@ -2018,7 +2003,7 @@ _io_BufferedWriter_write_impl(buffered *self, Py_buffer *buffer)
         Py_ssize_t n = _bufferedwriter_raw_write(
             self, (char *) buffer->buf + written, buffer->len - written);
         if (n == -1) {
-            goto error;
+            return -1;
         } else if (n == -2) {
             /* Write failed because raw file is non-blocking */
             if (remaining > self->buffer_size) {
@@ -2031,7 +2016,7 @@ _io_BufferedWriter_write_impl(buffered *self, Py_buffer *buffer)
                 written += self->buffer_size;
                 _set_BlockingIOError("write could not complete without "
                                      "blocking", written);
-                goto error;
+                return -1;
             }
             PyErr_Clear();
             break;
@@ -2042,7 +2027,7 @@ _io_BufferedWriter_write_impl(buffered *self, Py_buffer *buffer)
            signal (see write(2)).  We must run signal handlers before
            blocking another time, possibly indefinitely. */
         if (PyErr_CheckSignals() < 0)
-            goto error;
+            return -1;
     }
     if (self->readable)
         _bufferedreader_reset_buf(self);
@@ -2055,14 +2040,287 @@ _io_BufferedWriter_write_impl(buffered *self, Py_buffer *buffer)
     self->write_end = remaining;
     ADJUST_POSITION(self, remaining);
     self->raw_pos = 0;
+    return written;
+}
 
-end:
-    res = PyLong_FromSsize_t(written);
+/*[clinic input]
+_io.BufferedWriter.write
+    buffer: Py_buffer
+    /
+[clinic start generated code]*/
+
+static PyObject *
+_io_BufferedWriter_write_impl(buffered *self, Py_buffer *buffer)
+/*[clinic end generated code: output=7f8d1365759bfc6b input=dd87dd85fc7f8850]*/
+{
+    PyObject *res = NULL;
+    Py_ssize_t written;
+
+    CHECK_INITIALIZED(self)
+
+    if (!ENTER_BUFFERED(self))
+        return NULL;
+
+    /* Issue #31976: Check for closed file after acquiring the lock. Another
+       thread could be holding the lock while closing the file. */
+    if (IS_CLOSED(self)) {
+        PyErr_SetString(PyExc_ValueError, "write to closed file");
+        goto error;
+    }
+
+    written = _bufferedwriter_write_unlocked(self, buffer);
+    if (written >= 0)
+        res = PyLong_FromSsize_t(written);
 
 error:
     LEAVE_BUFFERED(self)
     return res;
 }
+
+#ifdef HAVE_WRITEV
+/* Maximum number of large lines passed to a single writev() call. */
+#define WRITELINES_IOV_MAX 64
+
+/* Write the buffered data followed by bufs[0:count] with writev() on fd,
+   with the lock held.  Whatever a short write leaves over (a non-blocking
+   stream would have blocked) goes through the regular write path. */
+static int
+_bufferedwriter_writev_unlocked(buffered *self, int fd,
+                                Py_buffer *bufs, int count)
+{
+    struct iovec iov[WRITELINES_IOV_MAX + 1];
+    int i, first = 0, niov = 0, has_pending = 0;
+    Py_ssize_t n;
+
+    if (VALID_WRITE_BUFFER(self) && self->write_pos < self->write_end) {
+        /* The buffered data can only be prepended if it starts at the raw
+           position and ends at the logical position; otherwise the
+           regular write path deals with seeking. */
+        if (self->raw_pos != self->write_pos || self->pos != self->write_end)
+            goto fallback;
+        iov[0].iov_base = self->buffer + self->write_pos;
+        iov[0].iov_len = (size_t)(self->write_end - self->write_pos);
+        niov = has_pending = 1;
+    }
+    else {
+        /* Move the raw stream back to the logical position, as in
+           _bufferedwriter_write_unlocked() (issue #6629). */
+        Py_off_t offset = RAW_OFFSET(self);
+        if (offset != 0) {
+            if (_buffered_raw_seek(self, -offset, 1) < 0)
+                return -1;
+            self->raw_pos -= offset;
+        }
+        _bufferedwriter_reset_buf(self);
+    }
+    /* Any read-ahead data is stale once the lines are written. */
+    if (self->readable)
+        _bufferedreader_reset_buf(self);
+    for (i = 0; i < count; i++) {
+        iov[niov].iov_base = bufs[i].buf;
+        iov[niov].iov_len = (size_t)bufs[i].len;
+        niov++;
+    }
+
+    while (first < niov) {
+        int async_err = 0;
+        do {
+            Py_BEGIN_ALLOW_THREADS
+            errno = 0;
+            n = writev(fd, iov + first, niov - first);
+            Py_END_ALLOW_THREADS
+        } while (n < 0 && errno == EINTR &&
+                 !(async_err = PyErr_CheckSignals()));
+        if (async_err)
+            return -1;
+        if (n < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+                break;
+            PyErr_SetFromErrno(PyExc_OSError);
+            return -1;
+        }
+        if (n == 0)
+            break;
+        if (self->abs_pos != -1)
+            self->abs_pos += n;
+        while (n > 0) {
+            size_t take = Py_MIN((size_t)n, iov[first].iov_len);
+            iov[first].iov_base = (char *)iov[first].iov_base + take;
+            iov[first].iov_len -= take;
+            n -= take;
+            if (has_pending && first == 0) {
+                self->write_pos += take;
+                self->raw_pos = self->write_pos;
+            }
+            if (iov[first].iov_len == 0)
+                first++;
+        }
+        /* Partial writes can return successfully when interrupted by a
+           signal (see write(2)).  We must run signal handlers before
+           blocking another time, possibly indefinitely. */
+        if (first < niov && PyErr_CheckSignals() < 0)
+            return -1;
+    }
+    if (has_pending && first > 0)
+        _bufferedwriter_reset_buf(self);
+    if (first == niov)
+        return 0;
+
+    /* Hand the rest to the regular write path. */
+    for (i = 0; i < count; i++) {
+        int k = i + has_pending;
+        Py_buffer rest;
+        if (k < first)
+            continue;
+        rest = bufs[i];
+        rest.buf = iov[k].iov_base;
+        rest.len = (Py_ssize_t)iov[k].iov_len;
+        if (_bufferedwriter_write_unlocked(self, &rest) < 0)
+            return -1;
+    }
+    return 0;
+
+fallback:
+    for (i = 0; i < count; i++) {
+        if (_bufferedwriter_write_unlocked(self, &bufs[i]) < 0)
+            return -1;
+    }
+    return 0;
+}
+
+/* Write bufs[0:*count] as above, then release them. */
+static int
+_bufferedwriter_writev_lines(buffered *self, int fd,
+                             Py_buffer *bufs, int *count)
+{
+    int i, r = _bufferedwriter_writev_unlocked(self, fd, bufs, *count);
+    for (i = 0; i < *count; i++)
+        PyBuffer_Release(&bufs[i]);
+    *count = 0;
+    return r;
+}
+#endif /* HAVE_WRITEV */
+
+/*[clinic input]
+_io.BufferedWriter.writelines
+    lines: object
+    /
+
+Write a list of lines to stream.
+
+Line separators are not added, so it is usual for each of the
+lines provided to have a line separator at the end.
+[clinic start generated code]*/
+
+static PyObject *
+_io_BufferedWriter_writelines(buffered *self, PyObject *lines)
+/*[clinic end generated code: output=7566d221eb1717a5 input=fc6d2d8b01bb2335]*/
+{
+    PyObject *write, *res = NULL;
+    Py_ssize_t i;
+#ifdef HAVE_WRITEV
+    Py_buffer bufs[WRITELINES_IOV_MAX];
+    int nbufs = 0, fd = -1, j;
+#endif
+
+    CHECK_INITIALIZED(self)
+
+    /* Lines are written with the lock held, so only lists and tuples are
+       handled here: iterating over them cannot run arbitrary code.  A
+       subclass overriding write() must also see every line. */
+    write = _PyType_Lookup(Py_TYPE(self), _PyIO_str_write);
+    if (!(PyList_CheckExact(lines) || PyTuple_CheckExact(lines)) ||
+        write == NULL ||
+        (write != _PyType_Lookup(&PyBufferedWriter_Type, _PyIO_str_write) &&
+         write != _PyType_Lookup(&PyBufferedRandom_Type, _PyIO_str_write)))
+    {
+        PyObject *iter;
+        if (_PyIOBase_check_closed((PyObject *)self, Py_True) == NULL)
+            return NULL;
+        iter = PyObject_GetIter(lines);
+        if (iter == NULL)
+            return NULL;
+        while (1) {
+            PyObject *line = PyIter_Next(iter);
+            if (line == NULL) {
+                Py_DECREF(iter);
+                if (PyErr_Occurred())
+                    return NULL;
+                Py_RETURN_NONE;
+            }
+            do {
+                res = PyObject_CallMethodOneArg((PyObject *)self,
+                                                _PyIO_str_write, line);
+            } while (res == NULL && _PyIO_trap_eintr());
+            Py_DECREF(line);
+            if (res == NULL) {
+                Py_DECREF(iter);
+                return NULL;
+            }
+            Py_DECREF(res);
+        }
+    }
+
+    if (!ENTER_BUFFERED(self))
+        return NULL;
+
+    if (IS_CLOSED(self)) {
+        PyErr_SetString(PyExc_ValueError, "write to closed file");
+        goto error;
+    }
+
+    for (i = 0; i < PySequence_Fast_GET_SIZE(lines); i++) {
+        Py_buffer buf;
+        Py_ssize_t n;
+
+        if (PyObject_GetBuffer(PySequence_Fast_GET_ITEM(lines, i),
+                               &buf, PyBUF_SIMPLE) < 0)
+            goto error;
+#ifdef HAVE_WRITEV
+        /* Lines too large to be worth buffering are collected, and then
+           written along with the buffered data by a single writev(). */
+        if (self->fast_closed_checks && buf.len >= self->buffer_size) {
+            if (fd < 0) {
+                fd = PyObject_AsFileDescriptor(self->raw);
+                if (fd < 0) {
+                    PyBuffer_Release(&buf);
+                    goto error;
+                }
+            }
+            bufs[nbufs++] = buf;
+            if (nbufs == WRITELINES_IOV_MAX &&
+                _bufferedwriter_writev_lines(self, fd, bufs, &nbufs) < 0)
+                goto error;
+            continue;
+        }
+        if (nbufs > 0 &&
+            _bufferedwriter_writev_lines(self, fd, bufs, &nbufs) < 0) {
+            PyBuffer_Release(&buf);
+            goto error;
+        }
+#endif
+        n = _bufferedwriter_write_unlocked(self, &buf);
+        PyBuffer_Release(&buf);
+        if (n < 0)
+            goto error;
+    }
+#ifdef HAVE_WRITEV
+    if (nbufs > 0 &&
+        _bufferedwriter_writev_lines(self, fd, bufs, &nbufs) < 0)
+        goto error;
+#endif
+    res = Py_None;
+    Py_INCREF(res);
+
+error:
+#ifdef HAVE_WRITEV
+    for (j = 0; j < nbufs; j++)
+        PyBuffer_Release(&bufs[j]);
+#endif
+    LEAVE_BUFFERED(self)
+    return res;
+}
+
 
 
 
@@ -2489,6 +2747,7 @@ static PyMethodDef bufferedwriter_methods[] = {
     {"_dealloc_warn", (PyCFunction)buffered_dealloc_warn, METH_O},
 
     _IO_BUFFEREDWRITER_WRITE_METHODDEF
+    _IO_BUFFEREDWRITER_WRITELINES_METHODDEF
     _IO__BUFFERED_TRUNCATE_METHODDEF
     {"flush", (PyCFunction)buffered_flush, METH_NOARGS},
     _IO__BUFFERED_SEEK_METHODDEF
@@ -2664,6 +2923,7 @@ static PyMethodDef bufferedrandom_methods[] = {
     _IO__BUFFERED_READLINE_METHODDEF
     _IO__BUFFERED_PEEK_METHODDEF
     _IO_BUFFEREDWRITER_WRITE_METHODDEF
+    _IO_BUFFEREDWRITER_WRITELINES_METHODDEF
     {"__sizeof__", (PyCFunction)buffered_sizeof, METH_NOARGS},
     {NULL, NULL}
 };
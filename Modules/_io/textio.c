@@ -423,6 +423,27 @@ _PyIncrementalNewlineDecoder_decode(PyObject *myself,
             /* We have already seen all newline types, no need to scan again */
             if (seennl == SEEN_ALL)
                 goto endscan;
+            if (kind == PyUnicode_1BYTE_KIND) {
+                const Py_UCS1 *s = (const Py_UCS1 *)in_str;
+                const Py_UCS1 *end = s + len;
+                while (seennl != SEEN_ALL) {
+                    const Py_UCS1 *cr = memchr(s, '\r', end - s);
+                    const Py_UCS1 *stop = (cr != NULL) ? cr : end;
+                    if (!(seennl & SEEN_LF) &&
+                        memchr(s, '\n', stop - s) != NULL)
+                        seennl |= SEEN_LF;
+                    if (cr == NULL)
+                        break;
+                    s = cr + 1;
+                    if (s < end && *s == '\n') {
+                        s++;
+                        seennl |= SEEN_CRLF;
+                    }
+                    else
+                        seennl |= SEEN_CR;
+                }
+                goto endscan;
+            }
             for (;;) {
                 Py_UCS4 c;
                 /* Fast loop for non-control characters */
@@ -464,29 +485,58 @@ _PyIncrementalNewlineDecoder_decode(PyObject *myself,
                 goto error;
             }
             in = out = 0;
-            for (;;) {
-                Py_UCS4 c;
-                /* Fast loop for non-control characters */
-                while ((c = PyUnicode_READ(kind, in_str, in++)) > '\r')
-                    PyUnicode_WRITE(kind, translated, out++, c);
-                if (c == '\n') {
-                    PyUnicode_WRITE(kind, translated, out++, c);
-                    seennl |= SEEN_LF;
-                    continue;
-                }
-                if (c == '\r') {
-                    if (PyUnicode_READ(kind, in_str, in) == '\n') {
-                        in++;
+            if (kind == PyUnicode_1BYTE_KIND) {
+                /* Copy the runs between \r bytes with memcpy(); bare \n
+                   only need looking for until the first one is seen. */
+                const Py_UCS1 *s = (const Py_UCS1 *)in_str;
+                const Py_UCS1 *end = s + len;
+                Py_UCS1 *t = (Py_UCS1 *)translated;
+                for (;;) {
+                    const Py_UCS1 *cr = memchr(s, '\r', end - s);
+                    const Py_UCS1 *stop = (cr != NULL) ? cr : end;
+                    if (!(seennl & SEEN_LF) &&
+                        memchr(s, '\n', stop - s) != NULL)
+                        seennl |= SEEN_LF;
+                    memcpy(t, s, stop - s);
+                    t += stop - s;
+                    if (cr == NULL)
+                        break;
+                    s = cr + 1;
+                    if (s < end && *s == '\n') {
+                        s++;
                         seennl |= SEEN_CRLF;
                     }
                     else
                         seennl |= SEEN_CR;
-                    PyUnicode_WRITE(kind, translated, out++, '\n');
-                    continue;
+                    *t++ = '\n';
+                }
+                out = t - (Py_UCS1 *)translated;
+            }
+            else {
+                for (;;) {
+                    Py_UCS4 c;
+                    /* Fast loop for non-control characters */
+                    while ((c = PyUnicode_READ(kind, in_str, in++)) > '\r')
+                        PyUnicode_WRITE(kind, translated, out++, c);
+                    if (c == '\n') {
+                        PyUnicode_WRITE(kind, translated, out++, c);
+                        seennl |= SEEN_LF;
+                        continue;
+                    }
+                    if (c == '\r') {
+                        if (PyUnicode_READ(kind, in_str, in) == '\n') {
+                            in++;
+                            seennl |= SEEN_CRLF;
+                        }
+                        else
+                            seennl |= SEEN_CR;
+                        PyUnicode_WRITE(kind, translated, out++, '\n');
+                        continue;
+                    }
+                    if (in > len)
+                        break;
+                    PyUnicode_WRITE(kind, translated, out++, c);
                 }
-                if (in > len)
-                    break;
-                PyUnicode_WRITE(kind, translated, out++, c);
             }
             Py_DECREF(output);
             output = PyUnicode_FromKindAndData(kind, translated, out);
@@ -635,6 +685,9 @@ incrementalnewlinedecoder_newlines_get(nldecoder_object *self, void *context)
 
 /* TextIOWrapper */
 
+/* Initial value of _CHUNK_SIZE */
+#define DEFAULT_CHUNK_SIZE 8192
+
 typedef PyObject *
         (*encodefunc_t)(PyObject *, PyObject *);
 
@@ -1190,7 +1243,7 @@ _io_TextIOWrapper___init___impl(textio *self, PyObject *buffer,
 
     Py_INCREF(errors);
     self->errors = errors;
-    self->chunk_size = 8192;
+    self->chunk_size = DEFAULT_CHUNK_SIZE;
     self->line_buffering = line_buffering;
     self->write_through = write_through;
     if (set_newline(self, newline) < 0) {
@@ -2109,6 +2162,11 @@ _PyIO_find_line_ending(
     }
 }
 
+/* When there are no tell() snapshots to maintain (e.g. while iterating)
+   and _CHUNK_SIZE has not been changed, readline() reads larger chunks: on
+   big files this saves many read and decoder calls. */
+#define READLINE_CHUNK_SIZE (64 * 1024)
+
 static PyObject *
 _textiowrapper_readline(textio *self, Py_ssize_t limit)
 {
@@ -2126,14 +2184,16 @@ _textiowrapper_readline(textio *self, Py_ssize_t limit)
     while (1) {
         const char *ptr;
         Py_ssize_t line_len;
-        int kind;
+        int kind, translated;
         Py_ssize_t consumed = 0;
 
         /* First, get some data if necessary */
         res = 1;
         while (!self->decoded_chars ||
                !PyUnicode_GET_LENGTH(self->decoded_chars)) {
-            res = textiowrapper_read_chunk(self, 0);
+            res = textiowrapper_read_chunk(
+                self, (self->telling || self->chunk_size != DEFAULT_CHUNK_SIZE)
+                      ? 0 : READLINE_CHUNK_SIZE);
             if (res < 0) {
                 /* NOTE: PyErr_SetFromErrno() calls PyErr_CheckSignals()
                    when EINTR occurs so we needn't do it ourselves. */
@@ -2175,8 +2235,16 @@ _textiowrapper_readline(textio *self, Py_ssize_t limit)
         line_len = PyUnicode_GET_LENGTH(line);
         kind = PyUnicode_KIND(line);
 
+        /* In untranslated universal mode, as long as the newline decoder
+           has not seen a lone \r, every line ends with the first \n. */
+        translated = self->readtranslate;
+        if (!translated && self->readuniversal &&
+            Py_IS_TYPE(self->decoder, &PyIncrementalNewlineDecoder_Type) &&
+            !(((nldecoder_object *)self->decoder)->seennl & SEEN_CR))
+            translated = 1;
+
         endpos = _PyIO_find_line_ending(
-            self->readtranslate, self->readuniversal, self->readnl,
+            translated, self->readuniversal, self->readnl,
             kind,
             ptr + kind * start,
             ptr + kind * line_len,
@@ -10,7 +10,6 @@
 
 #include "Python.h"
 #include "structmember.h"         // PyMemberDef
-#include "pycore_accu.h"
 
 typedef struct {
     PyObject *PyScannerType;
@@ -26,6 +25,15 @@ get_json_state(PyObject *module)
 }
 
 
+/* Object keys without escapes and at most KEY_CACHE_MAXLEN characters long
+   are looked up in a small direct-mapped cache that survives across calls
+   to scan_once(), so that decoding many objects of the same shape (e.g.
+   JSON Lines records) reuses the key strings instead of allocating and
+   hashing new ones.  Each entry also remembers the size of the last object
+   that started with that key, used to presize the next such dict. */
+#define KEY_CACHE_SIZE 256  /* must be a power of 2 */
+#define KEY_CACHE_MAXLEN 64
+
 typedef struct _PyScannerObject {
     PyObject_HEAD
     signed char strict;
@@ -35,6 +43,8 @@ typedef struct _PyScannerObject {
     PyObject *parse_int;
     PyObject *parse_constant;
     PyObject *memo;
+    PyObject *key_cache[KEY_CACHE_SIZE];
+    Py_ssize_t key_cache_size_hint[KEY_CACHE_SIZE];
 } PyScannerObject;
 
 static PyMemberDef scanner_members[] = {
@@ -61,6 +71,16 @@ typedef struct _PyEncoderObject {
     PyCFunction fast_encode;
 } PyEncoderObject;
 
+/* Text produced by an encoder call.  When write is not NULL, the text is
+   passed to it in chunks of about ENCODER_FLUSH_SIZE characters instead of
+   being accumulated in full. */
+typedef struct {
+    _PyUnicodeWriter writer;
+    PyObject *write;
+} encoder_output;
+
+#define ENCODER_FLUSH_SIZE (64 * 1024)
+
 static PyMemberDef encoder_members[] = {
     {"markers", T_OBJECT, offsetof(PyEncoderObject, markers), READONLY, "markers"},
     {"default", T_OBJECT, offsetof(PyEncoderObject, defaultfn), READONLY, "default"},
@@ -96,11 +116,11 @@ encoder_dealloc(PyObject *self);
 static int
 encoder_clear(PyEncoderObject *self);
 static int
-encoder_listencode_list(PyEncoderObject *s, _PyAccu *acc, PyObject *seq, Py_ssize_t indent_level);
+encoder_listencode_list(PyEncoderObject *s, encoder_output *out, PyObject *seq, Py_ssize_t indent_level);
 static int
-encoder_listencode_obj(PyEncoderObject *s, _PyAccu *acc, PyObject *obj, Py_ssize_t indent_level);
+encoder_listencode_obj(PyEncoderObject *s, encoder_output *out, PyObject *obj, Py_ssize_t indent_level);
 static int
-encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc, PyObject *dct, Py_ssize_t indent_level);
+encoder_listencode_dict(PyEncoderObject *s, encoder_output *out, PyObject *dct, Py_ssize_t indent_level);
 static PyObject *
 _encoded_const(PyObject *obj);
 static void
@@ -669,9 +689,90 @@ scanner_clear(PyScannerObject *self)
     Py_CLEAR(self->parse_int);
     Py_CLEAR(self->parse_constant);
     Py_CLEAR(self->memo);
+    for (int i = 0; i < KEY_CACHE_SIZE; i++) {
+        Py_CLEAR(self->key_cache[i]);
+    }
     return 0;
 }
 
+static int
+_scan_cached_key(PyScannerObject *s, PyObject *pystr, Py_ssize_t idx,
+                 Py_ssize_t *next_idx_ptr, PyObject **key_ptr, size_t *slot_ptr)
+{
+    /* Read a simple object key from PyUnicode pystr through the key cache.
+    idx is the index of the first character after the opening quote.
+    *next_idx_ptr is a return-by-reference index to the first character after
+        the closing quote.
+
+    Return 1 and store a new reference in *key_ptr on success.  Return 0 if
+    the key must be read by scanstring_unicode() (escapes, control characters,
+    long or unterminated keys), or -1 on error.
+    */
+    const void *str = PyUnicode_DATA(pystr);
+    int kind = PyUnicode_KIND(pystr);
+    Py_ssize_t len = PyUnicode_GET_LENGTH(pystr);
+    Py_ssize_t limit = Py_MIN(len, idx + KEY_CACHE_MAXLEN);
+    Py_ssize_t end, n;
+    size_t hash = 0, slot;
+    PyObject *key, *memokey;
+
+    for (end = idx; end < limit; end++) {
+        Py_UCS4 c = PyUnicode_READ(kind, str, end);
+        if (c == '"')
+            break;
+        if (c == '\\' || c < 0x20)
+            return 0;
+        hash = hash * 31 + c;
+    }
+    if (end == limit)
+        return 0;
+    n = end - idx;
+    slot = (hash ^ (size_t)n) & (KEY_CACHE_SIZE - 1);
+    *slot_ptr = slot;
+    *next_idx_ptr = end + 1;
+
+    key = s->key_cache[slot];
+    if (key != NULL && PyUnicode_GET_LENGTH(key) == n) {
+        int key_kind = PyUnicode_KIND(key);
+        const void *key_str = PyUnicode_DATA(key);
+        int equal;
+        if (key_kind == kind) {
+            equal = memcmp(key_str, (const char *)str + idx * kind,
+                           n * kind) == 0;
+        }
+        else {
+            Py_ssize_t i;
+            for (i = 0; i < n; i++) {
+                if (PyUnicode_READ(key_kind, key_str, i) !=
+                    PyUnicode_READ(kind, str, idx + i))
+                    break;
+            }
+            equal = (i == n);
+        }
+        if (equal) {
+            Py_INCREF(key);
+            *key_ptr = key;
+            return 1;
+        }
+    }
+
+    key = PyUnicode_Substring(pystr, idx, end);
+    if (key == NULL)
+        return -1;
+    memokey = PyDict_SetDefault(s->memo, key, key);
+    if (memokey == NULL) {
+        Py_DECREF(key);
+        return -1;
+    }
+    Py_INCREF(memokey);
+    Py_DECREF(key);
+    Py_INCREF(memokey);
+    Py_XSETREF(s->key_cache[slot], memokey);
+    s->key_cache_size_hint[slot] = 0;
+    *key_ptr = memokey;
+    return 1;
+}
+
 static PyObject *
 _parse_object_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t idx, Py_ssize_t *next_idx_ptr)
 {
@@ -688,8 +789,11 @@ _parse_object_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t idx, Py_ss
     PyObject *val = NULL;
     PyObject *rval = NULL;
     PyObject *key = NULL;
+    PyObject *first_key = NULL;
     int has_pairs_hook = (s->object_pairs_hook != Py_None);
     Py_ssize_t next_idx;
+    Py_ssize_t nitems = 0;
+    size_t slot = 0, first_slot = 0;
 
     if (PyUnicode_READY(pystr) == -1)
         return NULL;
@@ -698,12 +802,12 @@ _parse_object_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t idx, Py_ss
     kind = PyUnicode_KIND(pystr);
     end_idx = PyUnicode_GET_LENGTH(pystr) - 1;
 
-    if (has_pairs_hook)
+    /* The dict is created once the first key is known, see below. */
+    if (has_pairs_hook) {
         rval = PyList_New(0);
-    else
-        rval = PyDict_New();
-    if (rval == NULL)
-        return NULL;
+        if (rval == NULL)
+            return NULL;
+    }
 
     /* skip whitespace after { */
     while (idx <= end_idx && IS_WHITESPACE(PyUnicode_READ(kind,str, idx))) idx++;
@@ -712,22 +816,40 @@ _parse_object_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t idx, Py_ss
     if (idx > end_idx || PyUnicode_READ(kind, str, idx) != '}') {
         while (1) {
             PyObject *memokey;
+            int cached;
 
             /* read key */
             if (idx > end_idx || PyUnicode_READ(kind, str, idx) != '"') {
                 raise_errmsg("Expecting property name enclosed in double quotes", pystr, idx);
                 goto bail;
             }
-            key = scanstring_unicode(pystr, idx + 1, s->strict, &next_idx);
-            if (key == NULL)
-                goto bail;
-            memokey = PyDict_SetDefault(s->memo, key, key);
-            if (memokey == NULL) {
+            cached = _scan_cached_key(s, pystr, idx + 1, &next_idx, &key, &slot);
+            if (cached < 0)
                 goto bail;
+            if (!cached) {
+                key = scanstring_unicode(pystr, idx + 1, s->strict, &next_idx);
+                if (key == NULL)
+                    goto bail;
+                memokey = PyDict_SetDefault(s->memo, key, key);
+                if (memokey == NULL) {
+                    goto bail;
+                }
+                Py_INCREF(memokey);
+                Py_DECREF(key);
+                key = memokey;
+            }
+            if (nitems == 0 && cached) {
+                first_key = key;
+                first_slot = slot;
+            }
+            if (rval == NULL) {
+                /* Presize the dict for as many items as the last object
+                   starting with the same key had. */
+                Py_ssize_t hint = first_key ? s->key_cache_size_hint[first_slot] : 0;
+                rval = hint > 5 ? _PyDict_NewPresized(hint) : PyDict_New();
+                if (rval == NULL)
+                    goto bail;
             }
-            Py_INCREF(memokey);
-            Py_DECREF(key);
-            key = memokey;
             idx = next_idx;
 
             /* skip whitespace between key and : delimiter, read :, skip whitespace */
@@ -762,6 +884,7 @@ _parse_object_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t idx, Py_ss
                 Py_CLEAR(key);
                 Py_CLEAR(val);
             }
+            nitems++;
             idx = next_idx;
 
             /* skip whitespace before } or , */
@@ -783,6 +906,17 @@ _parse_object_unicode(PyScannerObject *s, PyObject *pystr, Py_ssize_t idx, Py_ss
 
     *next_idx_ptr = idx + 1;
 
+    if (rval == NULL) {
+        rval = PyDict_New();
+        if (rval == NULL)
+            return NULL;
+    }
+    /* first_key is borrowed from rval; the cache slot may have been reused
+       for another key while the values were parsed. */
+    if (first_key != NULL && s->key_cache[first_slot] == first_key) {
+        s->key_cache_size_hint[first_slot] = nitems;
+    }
+
     if (has_pairs_hook) {
         val = PyObject_CallOneArg(s->object_pairs_hook, rval);
         Py_DECREF(rval);
@@ -1254,6 +1388,12 @@ encoder_new(PyTypeObject *type, PyObject *args, PyObject *kwds)
                      "not %.200s", Py_TYPE(markers)->tp_name);
         return NULL;
     }
+    if (indent != Py_None && !PyUnicode_Check(indent)) {
+        PyErr_Format(PyExc_TypeError,
+                     "make_encoder() argument 4 must be str or None, "
+                     "not %.200s", Py_TYPE(indent)->tp_name);
+        return NULL;
+    }
 
     s = (PyEncoderObject *)type->tp_alloc(type, 0);
     if (s == NULL)
@@ -1290,20 +1430,40 @@ static PyObject *
 encoder_call(PyEncoderObject *self, PyObject *args, PyObject *kwds)
 {
     /* Python callable interface to encode_listencode_obj */
-    static char *kwlist[] = {"obj", "_current_indent_level", NULL};
-    PyObject *obj;
+    static char *kwlist[] = {"obj", "_current_indent_level", "write", NULL};
+    PyObject *obj, *result;
+    PyObject *write = Py_None;
     Py_ssize_t indent_level;
-    _PyAccu acc;
-    if (!PyArg_ParseTupleAndKeywords(args, kwds, "On:_iterencode", kwlist,
-        &obj, &indent_level))
+    encoder_output out;
+    if (!PyArg_ParseTupleAndKeywords(args, kwds, "On|O:_iterencode", kwlist,
+        &obj, &indent_level, &write))
         return NULL;
-    if (_PyAccu_Init(&acc))
+    _PyUnicodeWriter_Init(&out.writer);
+    out.writer.overallocate = 1;
+    out.write = (write != Py_None) ? write : NULL;
+    if (encoder_listencode_obj(self, &out, obj, indent_level)) {
+        _PyUnicodeWriter_Dealloc(&out.writer);
         return NULL;
-    if (encoder_listencode_obj(self, &acc, obj, indent_level)) {
-        _PyAccu_Destroy(&acc);
+    }
+    result = _PyUnicodeWriter_Finish(&out.writer);
+    if (result == NULL)
         return NULL;
+    if (out.write == NULL) {
+        PyObject *chunks = PyTuple_Pack(1, result);
+        Py_DECREF(result);
+        return chunks;
+    }
+    if (PyUnicode_GET_LENGTH(result)) {
+        PyObject *res = PyObject_CallOneArg(out.write, result);
+        Py_DECREF(result);
+        if (res == NULL)
+            return NULL;
+        Py_DECREF(res);
     }
-    return _PyAccu_FinishAsList(&acc);
+    else {
+        Py_DECREF(result);
+    }
+    Py_RETURN_NONE;
 }
 
 static PyObject *
@@ -1387,58 +1547,100 @@ encoder_encode_string(PyEncoderObject *s, PyObject *obj)
 }
 
 static int
-_steal_accumulate(_PyAccu *acc, PyObject *stolen)
+encoder_flush(encoder_output *out)
+{
+    /* Pass the text produced so far to out->write once it is large
+       enough, so that json.dump() does not build the whole document in
+       memory. */
+    PyObject *chunk, *res;
+
+    if (out->write == NULL || out->writer.pos < ENCODER_FLUSH_SIZE)
+        return 0;
+    chunk = _PyUnicodeWriter_Finish(&out->writer);
+    _PyUnicodeWriter_Init(&out->writer);
+    out->writer.overallocate = 1;
+    if (chunk == NULL)
+        return -1;
+    res = PyObject_CallOneArg(out->write, chunk);
+    Py_DECREF(chunk);
+    if (res == NULL)
+        return -1;
+    Py_DECREF(res);
+    return 0;
+}
+
+static int
+_steal_accumulate(encoder_output *out, PyObject *stolen)
 {
     /* Append stolen and then decrement its reference count */
-    int rval = _PyAccu_Accumulate(acc, stolen);
+    int rval = _PyUnicodeWriter_WriteStr(&out->writer, stolen);
     Py_DECREF(stolen);
     return rval;
 }
 
 static int
-encoder_listencode_obj(PyEncoderObject *s, _PyAccu *acc,
+encoder_write_newline_indent(PyEncoderObject *s, encoder_output *out,
+                             Py_ssize_t indent_level)
+{
+    /* Write '\n' + indent * indent_level */
+    Py_ssize_t i;
+
+    if (_PyUnicodeWriter_WriteChar(&out->writer, '\n'))
+        return -1;
+    for (i = 0; i < indent_level; i++) {
+        if (_PyUnicodeWriter_WriteStr(&out->writer, s->indent))
+            return -1;
+    }
+    return 0;
+}
+
+static int
+encoder_listencode_obj(PyEncoderObject *s, encoder_output *out,
                        PyObject *obj, Py_ssize_t indent_level)
 {
     /* Encode Python object obj to a JSON term */
     PyObject *newobj;
     int rv;
 
-    if (obj == Py_None || obj == Py_True || obj == Py_False) {
-        PyObject *cstr = _encoded_const(obj);
-        if (cstr == NULL)
-            return -1;
-        return _steal_accumulate(acc, cstr);
+    if (obj == Py_None) {
+        return _PyUnicodeWriter_WriteASCIIString(&out->writer, "null", 4);
+    }
+    else if (obj == Py_True) {
+        return _PyUnicodeWriter_WriteASCIIString(&out->writer, "true", 4);
+    }
+    else if (obj == Py_False) {
+        return _PyUnicodeWriter_WriteASCIIString(&out->writer, "false", 5);
     }
     else if (PyUnicode_Check(obj))
     {
         PyObject *encoded = encoder_encode_string(s, obj);
         if (encoded == NULL)
             return -1;
-        return _steal_accumulate(acc, encoded);
+        return _steal_accumulate(out, encoded);
     }
     else if (PyLong_Check(obj)) {
         PyObject *encoded = PyLong_Type.tp_repr(obj);
         if (encoded == NULL)
             return -1;
-        return _steal_accumulate(acc, encoded);
+        return _steal_accumulate(out, encoded);
     }
     else if (PyFloat_Check(obj)) {
         PyObject *encoded = encoder_encode_float(s, obj);
         if (encoded == NULL)
             return -1;
-        return _steal_accumulate(acc, encoded);
+        return _steal_accumulate(out, encoded);
     }
     else if (PyList_Check(obj) || PyTuple_Check(obj)) {
         if (Py_EnterRecursiveCall(" while encoding a JSON object"))
             return -1;
-        rv = encoder_listencode_list(s, acc, obj, indent_level);
+        rv = encoder_listencode_list(s, out, obj, indent_level);
         Py_LeaveRecursiveCall();
         return rv;
     }
     else if (PyDict_Check(obj)) {
         if (Py_EnterRecursiveCall(" while encoding a JSON object"))
             return -1;
-        rv = encoder_listencode_dict(s, acc, obj, indent_level);
+        rv = encoder_listencode_dict(s, out, obj, indent_level);
         Py_LeaveRecursiveCall();
         return rv;
     }
@@ -1472,7 +1674,7 @@ encoder_listencode_obj(PyEncoderObject *s, _PyAccu *acc,
             Py_XDECREF(ident);
             return -1;
         }
-        rv = encoder_listencode_obj(s, acc, newobj, indent_level);
+        rv = encoder_listencode_obj(s, out, newobj, indent_level);
         Py_LeaveRecursiveCall();
 
         Py_DECREF(newobj);
@@ -1492,16 +1694,10 @@ encoder_listencode_obj(PyEncoderObject *s, _PyAccu *acc,
 }
 
 static int
-encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc,
+encoder_listencode_dict(PyEncoderObject *s, encoder_output *out,
                         PyObject *dct, Py_ssize_t indent_level)
 {
     /* Encode Python dict dct a JSON term */
-    _Py_static_string(PyId_open_dict, "{");
-    _Py_static_string(PyId_close_dict, "}");
-    _Py_static_string(PyId_empty_dict, "{}");
-    PyObject *open_dict = _PyUnicode_FromId(&PyId_open_dict);    // borrowed ref
-    PyObject *close_dict = _PyUnicode_FromId(&PyId_close_dict);  // borrowed ref
-    PyObject *empty_dict = _PyUnicode_FromId(&PyId_empty_dict);  // borrowed ref
     PyObject *kstr = NULL;
     PyObject *ident = NULL;
     PyObject *it = NULL;
@@ -1509,11 +1705,8 @@ encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc,
     PyObject *item = NULL;
     Py_ssize_t idx;
 
-    if (open_dict == NULL || close_dict == NULL || empty_dict == NULL) {
-        return -1;
-    }
     if (PyDict_GET_SIZE(dct) == 0)  /* Fast path */
-        return _PyAccu_Accumulate(acc, empty_dict);
+        return _PyUnicodeWriter_WriteASCIIString(&out->writer, "{}", 2);
 
     if (s->markers != Py_None) {
         int has_key;
@@ -1531,17 +1724,13 @@ encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc,
         }
     }
 
-    if (_PyAccu_Accumulate(acc, open_dict))
+    if (_PyUnicodeWriter_WriteChar(&out->writer, '{'))
         goto bail;
 
     if (s->indent != Py_None) {
-        /* TODO: DOES NOT RUN */
         indent_level += 1;
-        /*
-            newline_indent = '\n' + (' ' * (_indent * _current_indent_level))
-            separator = _item_separator + newline_indent
-            buf += newline_indent
-        */
+        if (encoder_write_newline_indent(s, out, indent_level))
+            goto bail;
     }
 
     items = PyMapping_Items(dct);
@@ -1597,7 +1786,10 @@ encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc,
         }
 
         if (idx) {
-            if (_PyAccu_Accumulate(acc, s->item_separator))
+            if (_PyUnicodeWriter_WriteStr(&out->writer, s->item_separator))
+                goto bail;
+            if (s->indent != Py_None &&
+                encoder_write_newline_indent(s, out, indent_level))
                 goto bail;
         }
 
@@ -1605,16 +1797,15 @@ encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc,
         Py_CLEAR(kstr);
         if (encoded == NULL)
             goto bail;
-        if (_PyAccu_Accumulate(acc, encoded)) {
-            Py_DECREF(encoded);
+        if (_steal_accumulate(out, encoded))
             goto bail;
-        }
-        Py_DECREF(encoded);
-        if (_PyAccu_Accumulate(acc, s->key_separator))
+        if (_PyUnicodeWriter_WriteStr(&out->writer, s->key_separator))
             goto bail;
 
         value = PyTuple_GET_ITEM(item, 1);
-        if (encoder_listencode_obj(s, acc, value, indent_level))
+        if (encoder_listencode_obj(s, out, value, indent_level))
+            goto bail;
+        if (encoder_flush(out))
             goto bail;
         idx += 1;
         Py_DECREF(item);
@@ -1628,13 +1819,12 @@ encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc,
             goto bail;
         Py_CLEAR(ident);
     }
-    /* TODO DOES NOT RUN; dead code
     if (s->indent != Py_None) {
         indent_level -= 1;
-
-        yield '\n' + (' ' * (_indent * _current_indent_level))
-    }*/
-    if (_PyAccu_Accumulate(acc, close_dict))
+        if (encoder_write_newline_indent(s, out, indent_level))
+            goto bail;
+    }
+    if (_PyUnicodeWriter_WriteChar(&out->writer, '}'))
         goto bail;
     return 0;
 
@@ -1648,30 +1838,21 @@ encoder_listencode_dict(PyEncoderObject *s, _PyAccu *acc,
 
 
 static int
-encoder_listencode_list(PyEncoderObject *s, _PyAccu *acc,
+encoder_listencode_list(PyEncoderObject *s, encoder_output *out,
                         PyObject *seq, Py_ssize_t indent_level)
 {
     /* Encode Python list seq to a JSON term */
-    _Py_static_string(PyId_open_array, "[");
-    _Py_static_string(PyId_close_array, "]");
-    _Py_static_string(PyId_empty_array, "[]");
-    PyObject *open_array = _PyUnicode_FromId(&PyId_open_array);   // borrowed ref
-    PyObject *close_array = _PyUnicode_FromId(&PyId_close_array); // borrowed ref
-    PyObject *empty_array = _PyUnicode_FromId(&PyId_empty_array); // borrowed ref
     PyObject *ident = NULL;
     PyObject *s_fast = NULL;
     Py_ssize_t i;
 
-    if (open_array == NULL || close_array == NULL || empty_array == NULL) {
-        return -1;
-    }
     ident = NULL;
     s_fast = PySequence_Fast(seq, "_iterencode_list needs a sequence");
     if (s_fast == NULL)
         return -1;
     if (PySequence_Fast_GET_SIZE(s_fast) == 0) {
         Py_DECREF(s_fast);
-        return _PyAccu_Accumulate(acc, empty_array);
+        return _PyUnicodeWriter_WriteASCIIString(&out->writer, "[]", 2);
     }
 
     if (s->markers != Py_None) {
@@ -1690,24 +1871,25 @@ encoder_listencode_list(PyEncoderObject *s, _PyAccu *acc,
         }
     }
 
-    if (_PyAccu_Accumulate(acc, open_array))
+    if (_PyUnicodeWriter_WriteChar(&out->writer, '['))
         goto bail;
     if (s->indent != Py_None) {
-        /* TODO: DOES NOT RUN */
         indent_level += 1;
-        /*
-            newline_indent = '\n' + (' ' * (_indent * _current_indent_level))
-            separator = _item_separator + newline_indent
-            buf += newline_indent
-        */
+        if (encoder_write_newline_indent(s, out, indent_level))
+            goto bail;
     }
     for (i = 0; i < PySequence_Fast_GET_SIZE(s_fast); i++) {
         PyObject *obj = PySequence_Fast_GET_ITEM(s_fast, i);
         if (i) {
-            if (_PyAccu_Accumulate(acc, s->item_separator))
+            if (_PyUnicodeWriter_WriteStr(&out->writer, s->item_separator))
+                goto bail;
+            if (s->indent != Py_None &&
+                encoder_write_newline_indent(s, out, indent_level))
                 goto bail;
         }
-        if (encoder_listencode_obj(s, acc, obj, indent_level))
+        if (encoder_listencode_obj(s, out, obj, indent_level))
+            goto bail;
+        if (encoder_flush(out))
             goto bail;
     }
     if (ident != NULL) {
@@ -1716,13 +1898,12 @@ encoder_listencode_list(PyEncoderObject *s, _PyAccu *acc,
         Py_CLEAR(ident);
     }
 
-    /* TODO: DOES NOT RUN
     if (s->indent != Py_None) {
         indent_level -= 1;
-
-        yield '\n' + (' ' * (_indent * _current_indent_level))
-    }*/
-    if (_PyAccu_Accumulate(acc, close_array))
+        if (encoder_write_newline_indent(s, out, indent_level))
+            goto bail;
+    }
+    if (_PyUnicodeWriter_WriteChar(&out->writer, ']'))
         goto bail;
     Py_DECREF(s_fast);
     return 0;
@@ -1770,7 +1951,7 @@ encoder_clear(PyEncoderObject *self)
     return 0;
 }
 
-PyDoc_STRVAR(encoder_doc, "_iterencode(obj, _current_indent_level) -> iterable");
+PyDoc_STRVAR(encoder_doc, "_iterencode(obj, _current_indent_level, write=None) -> iterable");
 
 static PyType_Slot PyEncoderType_slots[] = {
     {Py_tp_doc, (void *)encoder_doc},
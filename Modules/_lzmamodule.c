@@ -48,6 +48,11 @@ enum {
 
 #define LZMA_CHECK_UNKNOWN (LZMA_CHECK_ID_MAX + 1)
 
+/* lzma_stream_encoder_mt() is available since liblzma 5.2.0. */
+#if LZMA_VERSION >= 50020002
+#define HAVE_LZMA_MT
+#endif
+
 
 typedef struct {
     PyObject_HEAD
@@ -617,11 +622,35 @@ _lzma_LZMACompressor_flush_impl(Compressor *self)
 
 static int
 Compressor_init_xz(_lzma_state *state, lzma_stream *lzs,
-                   int check, uint32_t preset, PyObject *filterspecs)
+                   int check, uint32_t preset, PyObject *filterspecs,
+                   uint32_t threads)
 {
     lzma_ret lzret;
 
-    if (filterspecs == Py_None) {
+    if (threads != 1) {
+#ifdef HAVE_LZMA_MT
+        lzma_mt mt_options = {0};
+        lzma_filter filters[LZMA_FILTERS_MAX + 1];
+
+        mt_options.threads = threads;
+        mt_options.preset = preset;
+        mt_options.check = check;
+        if (filterspecs != Py_None) {
+            if (parse_filter_chain_spec(state, filters, filterspecs) == -1)
+                return -1;
+            mt_options.filters = filters;
+        }
+        lzret = lzma_stream_encoder_mt(lzs, &mt_options);
+        if (filterspecs != Py_None) {
+            free_filter_chain(filters);
+        }
+#else
+        PyErr_SetString(PyExc_ValueError,
+                        "Multithreaded compression is not supported "
+                        "by this version of liblzma");
+        return -1;
+#endif
+    } else if (filterspecs == Py_None) {
         lzret = lzma_easy_encoder(lzs, preset, check);
     } else {
         lzma_filter filters[LZMA_FILTERS_MAX + 1];
@@ -721,6 +750,10 @@ _lzma.LZMACompressor.__init__
         have an entry for "id" indicating the ID of the filter, plus
         additional entries for options to the filter.
 
+    threads: int = 1
+        The number of worker threads to use for FORMAT_XZ, or 0 to use
+        one thread per CPU.
+
 Create a compressor object for compressing data incrementally.
 
 The settings used by the compressor can be specified either as a
@@ -735,18 +768,20 @@ For one-shot compression, use the compress() function instead.
 static int
 Compressor_init(Compressor *self, PyObject *args, PyObject *kwargs)
 {
-    static char *arg_names[] = {"format", "check", "preset", "filters", NULL};
+    static char *arg_names[] = {"format", "check", "preset", "filters",
+                                "threads", NULL};
     int format = FORMAT_XZ;
     int check = -1;
     uint32_t preset = LZMA_PRESET_DEFAULT;
     PyObject *preset_obj = Py_None;
     PyObject *filterspecs = Py_None;
+    int threads = 1;
     _lzma_state *state = PyType_GetModuleState(Py_TYPE(self));
     assert(state != NULL);
     if (!PyArg_ParseTupleAndKeywords(args, kwargs,
-                                     "|iiOO:LZMACompressor", arg_names,
+                                     "|iiOO$i:LZMACompressor", arg_names,
                                      &format, &check, &preset_obj,
-                                     &filterspecs)) {
+                                     &filterspecs, &threads)) {
         return -1;
     }
 
@@ -756,6 +791,26 @@ Compressor_init(Compressor *self, PyObject *args, PyObject *kwargs)
         return -1;
     }
 
+    if (threads < 0) {
+        PyErr_SetString(PyExc_ValueError,
+                        "threads must be a non-negative integer");
+        return -1;
+    }
+    if (format != FORMAT_XZ && threads != 1) {
+        PyErr_SetString(PyExc_ValueError,
+                        "Multithreaded compression is only supported "
+                        "by FORMAT_XZ");
+        return -1;
+    }
+    if (threads == 0) {
+#ifdef HAVE_LZMA_MT
+        threads = lzma_cputhreads();
+#endif
+        if (threads == 0) {
+            threads = 1;
+        }
+    }
+
     if (preset_obj != Py_None && filterspecs != Py_None) {
         PyErr_SetString(PyExc_ValueError,
                         "Cannot specify both preset and filter chain");
@@ -785,7 +840,8 @@ Compressor_init(Compressor *self, PyObject *args, PyObject *kwargs)
             if (check == -1) {
                 check = LZMA_CHECK_CRC64;
             }
-            if (Compressor_init_xz(state, &self->lzs, check, preset, filterspecs) != 0) {
+            if (Compressor_init_xz(state, &self->lzs, check, preset, filterspecs,
+                                   (uint32_t)threads) != 0) {
                 break;
             }
             return 0;
@@ -839,7 +895,8 @@ Compressor_traverse(Compressor *self, visitproc visit, void *arg)
 }
 
 PyDoc_STRVAR(Compressor_doc,
-"LZMACompressor(format=FORMAT_XZ, check=-1, preset=None, filters=None)\n"
+"LZMACompressor(format=FORMAT_XZ, check=-1, preset=None, filters=None, *,\n"
+"               threads=1)\n"
 "\n"
 "Create a compressor object for compressing data incrementally.\n"
 "\n"
@@ -864,6 +921,10 @@ PyDoc_STRVAR(Compressor_doc,
 "have an entry for \"id\" indicating the ID of the filter, plus\n"
 "additional entries for options to the filter.\n"
 "\n"
+"threads specifies the number of worker threads used to compress\n"
+"FORMAT_XZ data, or 0 to use one thread per CPU. With more than one\n"
+"thread, the input is split into blocks compressed in parallel.\n"
+"\n"
 "For one-shot compression, use the compress() function instead.\n");
 
 static PyType_Slot lzma_compressor_type_slots[] = {
@@ -693,6 +693,8 @@ typedef struct UnpicklerObject {
     int proto;                  /* Protocol of the pickle loaded. */
     int fix_imports;            /* Indicate whether Unpickler should fix
                                    the name of globals pickled by Python 2.x. */
+    int zero_copy;              /* Return BYTEARRAY8 payloads as memoryviews
+                                   of the input buffer instead of copies. */
 } UnpicklerObject;
 
 typedef struct {
@@ -1434,6 +1436,55 @@ _Unpickler_ReadInto(UnpicklerObject *self, char *buf, Py_ssize_t n)
     return n;
 }
 
+/* Return a memoryview of the next `n` bytes of the input buffer without
+   copying them.  This is only possible when unpickling from memory (that is
+   self->read is NULL); the view keeps the input object alive.
+
+   Returns NULL (with an exception set) on failure. */
+static PyObject *
+_Unpickler_ReadView(UnpicklerObject *self, Py_ssize_t n)
+{
+    PyObject *view, *slice, *result;
+    Py_ssize_t start = self->next_read_idx;
+
+    assert(self->read == NULL && self->buffer.obj != NULL);
+    if (n > self->input_len - start) {
+        bad_readline();
+        return NULL;
+    }
+
+    view = PyMemoryView_FromObject(self->buffer.obj);
+    if (view == NULL) {
+        return NULL;
+    }
+    if (strcmp(PyMemoryView_GET_BUFFER(view)->format, "B") != 0) {
+        Py_SETREF(view, PyObject_CallMethod(view, "cast", "s", "B"));
+        if (view == NULL) {
+            return NULL;
+        }
+    }
+    if (PyMemoryView_GET_BUFFER(view)->len != self->input_len) {
+        PyErr_SetString(PyExc_BufferError,
+                        "pickle data buffer changed size during unpickling");
+        Py_DECREF(view);
+        return NULL;
+    }
+
+    slice = _PySlice_FromIndices(start, start + n);
+    if (slice == NULL) {
+        Py_DECREF(view);
+        return NULL;
+    }
+    result = PyObject_GetItem(view, slice);
+    Py_DECREF(slice);
+    Py_DECREF(view);
+    if (result == NULL) {
+        return NULL;
+    }
+    self->next_read_idx += n;
+    return result;
+}
+
 /* Read `n` bytes from the unpickler's data source, storing the result in `*s`.
 
    This should be used for all data reads, rather than accessing the unpickler's
@@ -1612,6 +1663,7 @@ _Unpickler_New(void)
     self->marks_size = 0;
     self->proto = 0;
     self->fix_imports = 0;
+    self->zero_copy = 0;
     memset(&self->buffer, 0, sizeof(Py_buffer));
     self->memo_size = 32;
     self->memo_len = 0;
@@ -5558,6 +5610,16 @@ load_counted_bytearray(UnpicklerObject *self)
         return -1;
     }
 
+    if (self->zero_copy && self->read == NULL) {
+        /* The whole pickle is in self->buffer: return a view on it. */
+        bytearray = _Unpickler_ReadView(self, size);
+        if (bytearray == NULL) {
+            return -1;
+        }
+        PDATA_PUSH(self->stack, bytearray, -1);
+        return 0;
+    }
+
     bytearray = PyByteArray_FromStringAndSize(NULL, size);
     if (bytearray == NULL) {
         return -1;
@@ -7844,6 +7906,7 @@ _pickle.loads
   encoding: str = 'ASCII'
   errors: str = 'strict'
   buffers: object(c_default="NULL") = ()
+  zero_copy: bool = False
 
 Read and return an object from the given pickle data.
 
@@ -7859,13 +7922,18 @@ map the old Python 2 names to the new names used in Python 3.  The
 instances pickled by Python 2; these default to 'ASCII' and 'strict',
 respectively.  The *encoding* can be 'bytes' to read these 8-bit
 string instances as bytes objects.
+
+If *zero_copy* is true, the bytearray payloads of a protocol 5 pickle,
+which include in-band PickleBuffer payloads and plain bytearray objects,
+are returned as memoryviews of *data* instead of being copied into new
+bytearray objects.
 [clinic start generated code]*/
 
 static PyObject *
 _pickle_loads_impl(PyObject *module, PyObject *data, int fix_imports,
                    const char *encoding, const char *errors,
-                   PyObject *buffers)
-/*[clinic end generated code: output=82ac1e6b588e6d02 input=b3615540d0535087]*/
+                   PyObject *buffers, int zero_copy)
+/*[clinic end generated code: output=fcd658005b49060e input=8380f8fe162b9afd]*/
 {
     PyObject *result;
     UnpicklerObject *unpickler = _Unpickler_New();
@@ -7883,6 +7951,7 @@ _pickle_loads_impl(PyObject *module, PyObject *data, int fix_imports,
         goto error;
 
     unpickler->fix_imports = fix_imports;
+    unpickler->zero_copy = zero_copy;
 
     result = load(unpickler);
     Py_DECREF(unpickler);
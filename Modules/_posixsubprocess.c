@@ -341,7 +341,7 @@ _close_open_fds_safe(int start_fd, PyObject* py_fds_to_keep)
     }
 }
 
-#define _close_open_fds _close_open_fds_safe
+#define _close_open_fds_fallback _close_open_fds_safe
 
 #else  /* NOT (defined(__linux__) && defined(HAVE_SYS_SYSCALL_H)) */
 
@@ -410,11 +410,63 @@ _close_open_fds_maybe_unsafe(long start_fd, PyObject* py_fds_to_keep)
     }
 }
 
-#define _close_open_fds _close_open_fds_maybe_unsafe
+#define _close_open_fds_fallback _close_open_fds_maybe_unsafe
 
 #endif  /* else NOT (defined(__linux__) && defined(HAVE_SYS_SYSCALL_H)) */
 
 
+#ifdef HAVE_CLOSE_RANGE
+/* Close all file descriptors from start_fd and higher except for those in
+ * the sorted py_fds_to_keep tuple, with one close_range() call per gap.
+ * close_range() is a plain system call, so this is async signal safe and
+ * usable after vfork().  Unlike the directory scanning fallbacks, its cost
+ * does not depend on how many descriptors the parent has open.
+ *
+ * Return 0 on success.  Return -1 if close_range() is unusable, e.g. the
+ * kernel is older than the C library or a seccomp filter rejects it.  The
+ * caller then falls back to closing descriptors one at a time, which is
+ * harmless even if some of them were already closed here.
+ */
+static int
+_close_range_except(long start_fd, PyObject *py_fds_to_keep)
+{
+    Py_ssize_t num_fds_to_keep = PyTuple_GET_SIZE(py_fds_to_keep);
+    Py_ssize_t keep_seq_idx;
+    for (keep_seq_idx = 0; keep_seq_idx < num_fds_to_keep; ++keep_seq_idx) {
+        PyObject* py_keep_fd = PyTuple_GET_ITEM(py_fds_to_keep, keep_seq_idx);
+        long keep_fd = PyLong_AsLong(py_keep_fd);
+        if (keep_fd < start_fd)
+            continue;
+        if (keep_fd > start_fd) {
+            if (close_range((unsigned int)start_fd,
+                            (unsigned int)(keep_fd - 1), 0) < 0) {
+                return -1;
+            }
+        }
+        start_fd = keep_fd + 1;
+    }
+    if (close_range((unsigned int)start_fd, ~0U, 0) < 0) {
+        return -1;
+    }
+    return 0;
+}
+#endif  /* HAVE_CLOSE_RANGE */
+
+
+/* Close all open file descriptors from start_fd and higher.
+ * Do not close any in the sorted py_fds_to_keep tuple. */
+static void
+_close_open_fds(long start_fd, PyObject *py_fds_to_keep)
+{
+#ifdef HAVE_CLOSE_RANGE
+    if (_close_range_except(start_fd, py_fds_to_keep) == 0) {
+        return;
+    }
+#endif
+    _close_open_fds_fallback(start_fd, py_fds_to_keep);
+}
+
+
 #ifdef VFORK_USABLE
 /* Reset dispositions for all signals to SIG_DFL except for ignored
  * signals. This way we ensure that no signal handlers can run
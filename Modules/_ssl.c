@@ -2185,6 +2185,43 @@ _ssl__SSLSocket_compression_impl(PySSLSocket *self)
 #endif
 }
 
+/*[clinic input]
+_ssl._SSLSocket.uses_ktls_for_send
+
+Return True if records sent on this connection are encrypted by the kernel.
+
+Kernel TLS is only used if OP_ENABLE_KTLS was set on the context, the
+platform supports it, and the negotiated cipher can be offloaded.
+[clinic start generated code]*/
+
+static PyObject *
+_ssl__SSLSocket_uses_ktls_for_send_impl(PySSLSocket *self)
+/*[clinic end generated code: output=f9d95fbefceb5068 input=4c4933508bfc68c7]*/
+{
+#ifdef BIO_get_ktls_send
+    if (self->ssl != NULL && BIO_get_ktls_send(SSL_get_wbio(self->ssl)))
+        Py_RETURN_TRUE;
+#endif
+    Py_RETURN_FALSE;
+}
+
+/*[clinic input]
+_ssl._SSLSocket.uses_ktls_for_recv
+
+Return True if records received on this connection are decrypted by the kernel.
+[clinic start generated code]*/
+
+static PyObject *
+_ssl__SSLSocket_uses_ktls_for_recv_impl(PySSLSocket *self)
+/*[clinic end generated code: output=ce38b00317a1f681 input=cba029acdfea769d]*/
+{
+#ifdef BIO_get_ktls_recv
+    if (self->ssl != NULL && BIO_get_ktls_recv(SSL_get_rbio(self->ssl)))
+        Py_RETURN_TRUE;
+#endif
+    Py_RETURN_FALSE;
+}
+
 static PySSLContext *PySSL_get_context(PySSLSocket *self, void *closure) {
     Py_INCREF(self->ctx);
     return self->ctx;
@@ -3004,6 +3041,8 @@ static PyMethodDef PySSLMethods[] = {
     _SSL__SSLSOCKET_SELECTED_NPN_PROTOCOL_METHODDEF
     _SSL__SSLSOCKET_SELECTED_ALPN_PROTOCOL_METHODDEF
     _SSL__SSLSOCKET_COMPRESSION_METHODDEF
+    _SSL__SSLSOCKET_USES_KTLS_FOR_SEND_METHODDEF
+    _SSL__SSLSOCKET_USES_KTLS_FOR_RECV_METHODDEF
     _SSL__SSLSOCKET_SHUTDOWN_METHODDEF
     _SSL__SSLSOCKET_VERIFY_CLIENT_POST_HANDSHAKE_METHODDEF
     {NULL, NULL}
@@ -6293,6 +6332,9 @@ sslmodule_init_constants(PyObject *m)
     PyModule_AddIntConstant(m, "OP_NO_RENEGOTIATION",
                             SSL_OP_NO_RENEGOTIATION);
 #endif
+#ifdef SSL_OP_ENABLE_KTLS
+    PyModule_AddIntConstant(m, "OP_ENABLE_KTLS", SSL_OP_ENABLE_KTLS);
+#endif
 
 #ifdef X509_CHECK_FLAG_ALWAYS_CHECK_SUBJECT
     PyModule_AddIntConstant(m, "HOSTFLAG_ALWAYS_CHECK_SUBJECT",
@@ -1509,6 +1509,23 @@ s_dealloc(PyStructObject *s)
     Py_DECREF(tp);
 }
 
+static PyObject *
+s_unpack_value(const formatcode *code, const char *res,
+               _structmodulestate *state)
+{
+    const formatdef *e = code->fmtdef;
+    if (e->format == 's') {
+        return PyBytes_FromStringAndSize(res, code->size);
+    } else if (e->format == 'p') {
+        Py_ssize_t n = *(unsigned char*)res;
+        if (n >= code->size)
+            n = code->size - 1;
+        return PyBytes_FromStringAndSize(res + 1, n);
+    } else {
+        return e->unpack(state, res, e);
+    }
+}
+
 static PyObject *
 s_unpack_internal(PyStructObject *soself, const char *startfrom,
                   _structmodulestate *state) {
@@ -1519,21 +1536,10 @@ s_unpack_internal(PyStructObject *soself, const char *startfrom,
         return NULL;
 
     for (code = soself->s_codes; code->fmtdef != NULL; code++) {
-        const formatdef *e = code->fmtdef;
         const char *res = startfrom + code->offset;
         Py_ssize_t j = code->repeat;
         while (j--) {
-            PyObject *v;
-            if (e->format == 's') {
-                v = PyBytes_FromStringAndSize(res, code->size);
-            } else if (e->format == 'p') {
-                Py_ssize_t n = *(unsigned char*)res;
-                if (n >= code->size)
-                    n = code->size - 1;
-                v = PyBytes_FromStringAndSize(res + 1, n);
-            } else {
-                v = e->unpack(state, res, e);
-            }
+            PyObject *v = s_unpack_value(code, res, state);
             if (v == NULL)
                 goto fail;
             PyTuple_SET_ITEM(result, i++, v);
@@ -1779,6 +1785,161 @@ Struct_iter_unpack(PyStructObject *self, PyObject *buffer)
 }
 
 
+/* Return the memoryview format of a column of values of the format code e,
+   or 0 if such a column must be a list. */
+static char
+column_format(const formatdef *e)
+{
+    switch (e->format) {
+    case 's': case 'p': case '?': case 'e':
+        /* memoryview does not support 'e'. */
+        return 0;
+    case 'c': case 'f': case 'd': case 'P':
+        return e->format;
+    }
+    switch (e->size) {
+    case 1:
+        return islower(e->format) ? 'b' : 'B';
+    case 2:
+        return islower(e->format) ? 'h' : 'H';
+    case 4:
+        return islower(e->format) ? 'i' : 'I';
+    case 8:
+        return islower(e->format) ? 'q' : 'Q';
+    }
+    return 0;
+}
+
+/* Return a read-only memoryview of the count values of code found at record
+   and every stride bytes after it, converted to native byte order. */
+static PyObject *
+unpack_column_view(const formatcode *code, const char *record,
+                   Py_ssize_t count, Py_ssize_t stride, char format)
+{
+    const formatdef *e = code->fmtdef;
+    Py_ssize_t size = code->size, i, b;
+    PyObject *bytes, *view, *result;
+    char *p, castfmt[2] = {format, '\0'};
+    int swap;
+
+#if PY_LITTLE_ENDIAN
+    swap = e >= bigendian_table &&
+           e < bigendian_table + Py_ARRAY_LENGTH(bigendian_table);
+#else
+    swap = e >= lilendian_table &&
+           e < lilendian_table + Py_ARRAY_LENGTH(lilendian_table);
+#endif
+
+    bytes = PyBytes_FromStringAndSize(NULL, count * size);
+    if (bytes == NULL)
+        return NULL;
+    p = PyBytes_AS_STRING(bytes);
+    if (swap) {
+        for (i = 0; i < count; i++, record += stride, p += size) {
+            for (b = 0; b < size; b++)
+                p[b] = record[size - 1 - b];
+        }
+    }
+    else {
+        for (i = 0; i < count; i++, record += stride, p += size)
+            memcpy(p, record, size);
+    }
+    view = PyMemoryView_FromObject(bytes);
+    Py_DECREF(bytes);
+    if (view == NULL)
+        return NULL;
+    result = PyObject_CallMethod(view, "cast", "s", castfmt);
+    Py_DECREF(view);
+    return result;
+}
+
+/*[clinic input]
+Struct.unpack_columns
+
+    buffer: Py_buffer
+    /
+
+Return a tuple containing one column of values per item of the format.
+
+The buffer holds consecutive records of Struct.size bytes, like the
+source of iter_unpack().  The n-th column contains the n-th value of every
+record, in order, so that the result is the transpose of
+list(iter_unpack(buffer)).
+
+Columns of integers, floats (except 'e') and 'c' items are read-only
+memoryviews of the values converted to native byte order, cast to a native
+format of the same size.  Columns of 's', 'p', '?' and 'e' items are lists.
+
+Requires that the buffer length be a multiple of the struct size.
+[clinic start generated code]*/
+
+static PyObject *
+Struct_unpack_columns_impl(PyStructObject *self, Py_buffer *buffer)
+/*[clinic end generated code: output=248511f7e13c1dba input=43bc01b0c778ba9d]*/
+{
+    _structmodulestate *state = get_struct_state_structinst(self);
+    formatcode *code;
+    Py_ssize_t count, i, k;
+    const char *record;
+    PyObject *result;
+
+    assert(self->s_codes != NULL);
+
+    if (self->s_size == 0) {
+        PyErr_Format(state->StructError,
+                     "cannot unpack columns with a struct of length 0");
+        return NULL;
+    }
+    if (buffer->len % self->s_size != 0) {
+        PyErr_Format(state->StructError,
+                     "unpacking columns requires a buffer of "
+                     "a multiple of %zd bytes",
+                     self->s_size);
+        return NULL;
+    }
+    count = buffer->len / self->s_size;
+
+    result = PyTuple_New(self->s_len);
+    if (result == NULL)
+        return NULL;
+
+    /* Fill the columns one format code at a time, so that the inner loop
+       always calls the same unpack function, or only copies bytes. */
+    k = 0;
+    for (code = self->s_codes; code->fmtdef != NULL; code++) {
+        char format = column_format(code->fmtdef);
+        Py_ssize_t j;
+        for (j = 0; j < code->repeat; j++, k++) {
+            PyObject *column;
+            record = (const char *)buffer->buf + code->offset + j * code->size;
+            if (format) {
+                column = unpack_column_view(code, record, count,
+                                            self->s_size, format);
+                if (column == NULL)
+                    goto fail;
+                PyTuple_SET_ITEM(result, k, column);
+                continue;
+            }
+            column = PyList_New(count);
+            if (column == NULL)
+                goto fail;
+            PyTuple_SET_ITEM(result, k, column);
+            for (i = 0; i < count; i++, record += self->s_size) {
+                PyObject *v = s_unpack_value(code, record, state);
+                if (v == NULL)
+                    goto fail;
+                PyList_SET_ITEM(column, i, v);
+            }
+        }
+    }
+    return result;
+
+fail:
+    Py_DECREF(result);
+    return NULL;
+}
+
+
 /*
  * Guts of the pack function.
  *
@@ -1913,6 +2074,105 @@ s_pack(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
     return _PyBytesWriter_Finish(&writer, buf + soself->s_size);
 }
 
+PyDoc_STRVAR(s_pack_columns__doc__,
+"S.pack_columns(c1, c2, ...) -> bytes\n\
+\n\
+Return a bytes object containing one record per row of the columns\n\
+c1, c2, ..., packed according to the format string S.format.  Each\n\
+column is a sequence holding the values of one item of the format,\n\
+and all columns must have the same length.  This is the inverse of\n\
+S.unpack_columns().  See help(struct) for more on format strings.");
+
+static PyObject *
+s_pack_columns(PyObject *self, PyObject *const *args, Py_ssize_t nargs)
+{
+    PyStructObject *soself;
+    PyObject **columns = NULL, **items = NULL;
+    PyObject *result = NULL;
+    Py_ssize_t count = 0, i, k;
+    char *buf;
+    _structmodulestate *state = get_struct_state_structinst(self);
+
+    /* Validate arguments. */
+    soself = (PyStructObject *)self;
+    assert(PyStruct_Check(self, state));
+    assert(soself->s_codes != NULL);
+    if (nargs != soself->s_len)
+    {
+        PyErr_Format(state->StructError,
+            "pack_columns expected %zd columns (got %zd)", soself->s_len, nargs);
+        return NULL;
+    }
+
+    columns = PyMem_New(PyObject *, nargs + 1);
+    items = PyMem_New(PyObject *, nargs + 1);
+    if (columns == NULL || items == NULL) {
+        PyErr_NoMemory();
+        nargs = 0;
+        goto done;
+    }
+    for (k = 0; k < nargs; k++) {
+        columns[k] = PySequence_Fast(args[k], "columns must be sequences");
+        if (columns[k] == NULL) {
+            nargs = k;
+            goto done;
+        }
+        if (k == 0) {
+            count = PySequence_Fast_GET_SIZE(columns[k]);
+        }
+        else if (PySequence_Fast_GET_SIZE(columns[k]) != count) {
+            PyErr_Format(state->StructError,
+                         "pack_columns expected columns of length %zd "
+                         "(got %zd for column %zd)",
+                         count, PySequence_Fast_GET_SIZE(columns[k]), k);
+            nargs = k + 1;
+            goto done;
+        }
+    }
+
+    if (count > 0 && soself->s_size > PY_SSIZE_T_MAX / count) {
+        PyErr_NoMemory();
+        goto done;
+    }
+    result = PyBytes_FromStringAndSize(NULL, count * soself->s_size);
+    if (result == NULL)
+        goto done;
+    buf = PyBytes_AS_STRING(result);
+    for (i = 0; i < count; i++, buf += soself->s_size) {
+        int status;
+        /* Columns that are lists may be mutated by the conversion
+           methods of the values being packed. */
+        for (k = 0; k < nargs; k++) {
+            if (i >= PySequence_Fast_GET_SIZE(columns[k])) {
+                PyErr_SetString(PyExc_RuntimeError,
+                                "column changed size during packing");
+                Py_CLEAR(result);
+                goto done;
+            }
+        }
+        for (k = 0; k < nargs; k++) {
+            items[k] = PySequence_Fast_GET_ITEM(columns[k], i);
+            Py_INCREF(items[k]);
+        }
+        status = s_pack_internal(soself, items, 0, buf, state);
+        for (k = 0; k < nargs; k++)
+            Py_DECREF(items[k]);
+        if (status != 0) {
+            Py_CLEAR(result);
+            goto done;
+        }
+    }
+
+done:
+    if (columns != NULL) {
+        for (k = 0; k < nargs; k++)
+            Py_DECREF(columns[k]);
+        PyMem_Free(columns);
+    }
+    PyMem_Free(items);
+    return result;
+}
+
 PyDoc_STRVAR(s_pack_into__doc__,
 "S.pack_into(buffer, offset, v1, v2, ...)\n\
 \n\
@@ -2048,8 +2308,10 @@ s_sizeof(PyStructObject *self, void *unused)
 static struct PyMethodDef s_methods[] = {
     STRUCT_ITER_UNPACK_METHODDEF
     {"pack",            (PyCFunction)(void(*)(void))s_pack, METH_FASTCALL, s_pack__doc__},
+    {"pack_columns",    (PyCFunction)(void(*)(void))s_pack_columns, METH_FASTCALL, s_pack_columns__doc__},
     {"pack_into",       (PyCFunction)(void(*)(void))s_pack_into, METH_FASTCALL, s_pack_into__doc__},
     STRUCT_UNPACK_METHODDEF
+    STRUCT_UNPACK_COLUMNS_METHODDEF
     STRUCT_UNPACK_FROM_METHODDEF
     {"__sizeof__",      (PyCFunction)s_sizeof, METH_NOARGS, s_sizeof__doc__},
     {NULL,       NULL}          /* sentinel */
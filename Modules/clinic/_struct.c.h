@@ -162,6 +162,53 @@ PyDoc_STRVAR(Struct_iter_unpack__doc__,
 #define STRUCT_ITER_UNPACK_METHODDEF    \
     {"iter_unpack", (PyCFunction)Struct_iter_unpack, METH_O, Struct_iter_unpack__doc__},
 
+PyDoc_STRVAR(Struct_unpack_columns__doc__,
+"unpack_columns($self, buffer, /)\n"
+"--\n"
+"\n"
+"Return a tuple containing one column of values per item of the format.\n"
+"\n"
+"The buffer holds consecutive records of Struct.size bytes, like the\n"
+"source of iter_unpack().  The n-th column contains the n-th value of every\n"
+"record, in order, so that the result is the transpose of\n"
+"list(iter_unpack(buffer)).\n"
+"\n"
+"Columns of integers, floats (except \'e\') and \'c\' items are read-only\n"
+"memoryviews of the values converted to native byte order, cast to a native\n"
+"format of the same size.  Columns of \'s\', \'p\', \'?\' and \'e\' items are lists.\n"
+"\n"
+"Requires that the buffer length be a multiple of the struct size.");
+
+#define STRUCT_UNPACK_COLUMNS_METHODDEF    \
+    {"unpack_columns", (PyCFunction)Struct_unpack_columns, METH_O, Struct_unpack_columns__doc__},
+
+static PyObject *
+Struct_unpack_columns_impl(PyStructObject *self, Py_buffer *buffer);
+
+static PyObject *
+Struct_unpack_columns(PyStructObject *self, PyObject *arg)
+{
+    PyObject *return_value = NULL;
+    Py_buffer buffer = {NULL, NULL};
+
+    if (PyObject_GetBuffer(arg, &buffer, PyBUF_SIMPLE) != 0) {
+        goto exit;
+    }
+    if (!PyBuffer_IsContiguous(&buffer, 'C')) {
+        _PyArg_BadArgument("unpack_columns", "argument", "contiguous buffer", arg);
+        goto exit;
+    }
+    return_value = Struct_unpack_columns_impl(self, &buffer);
+
+exit:
+    /* Cleanup for buffer */
+    if (buffer.obj) {
+       PyBuffer_Release(&buffer);
+    }
+
+    return return_value;
+}
+
 PyDoc_STRVAR(_clearcache__doc__,
 "_clearcache($module, /)\n"
 "--\n"
@@ -376,4 +423,4 @@ iter_unpack(PyObject *module, PyObject *const *args, Py_ssize_t nargs)
 
     return return_value;
 }
-/*[clinic end generated code: output=a3d3cd900091cb1c input=a9049054013a1b77]*/
+/*[clinic end generated code: output=6476933101fd47d7 input=a9049054013a1b77]*/
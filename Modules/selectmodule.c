@@ -1508,34 +1508,16 @@ select_epoll_unregister_impl(pyEpoll_Object *self, int fd)
     return pyepoll_internal_ctl(self->epfd, EPOLL_CTL_DEL, fd, 0);
 }
 
-/*[clinic input]
-select.epoll.poll
-
-    timeout as timeout_obj: object = None
-      the maximum time to wait in seconds (as float);
-      a timeout of None or -1 makes poll wait indefinitely
-    maxevents: int = -1
-      the maximum number of events returned; -1 means no limit
-
-Wait for events on the epoll file descriptor.
-
-Returns a list containing any descriptors that have events to report,
-as a list of (fd, events) 2-tuples.
-[clinic start generated code]*/
-
-static PyObject *
-select_epoll_poll_impl(pyEpoll_Object *self, PyObject *timeout_obj,
-                       int maxevents)
-/*[clinic end generated code: output=e02d121a20246c6c input=33d34a5ea430fd5b]*/
+/* Wait for at most maxevents events on the epoll object, retrying on EINTR
+   with a recomputed timeout.  Return the number of events stored in evs, or
+   -1 with an exception set. */
+static int
+pyepoll_internal_wait(pyEpoll_Object *self, PyObject *timeout_obj,
+                      struct epoll_event *evs, int maxevents)
 {
-    int nfds, i;
-    PyObject *elist = NULL, *etuple = NULL;
-    struct epoll_event *evs = NULL;
+    int nfds;
     _PyTime_t timeout = -1, ms = -1, deadline = 0;
 
-    if (self->epfd < 0)
-        return pyepoll_err_closed();
-
     if (timeout_obj != Py_None) {
         /* epoll_wait() has a resolution of 1 millisecond, round towards
            infinity to wait at least timeout seconds. */
@@ -1545,13 +1527,13 @@ select_epoll_poll_impl(pyEpoll_Object *self, PyObject *timeout_obj,
                 PyErr_SetString(PyExc_TypeError,
                                 "timeout must be an integer or None");
             }
-            return NULL;
+            return -1;
         }
 
         ms = _PyTime_AsMilliseconds(timeout, _PyTime_ROUND_CEILING);
         if (ms < INT_MIN || ms > INT_MAX) {
             PyErr_SetString(PyExc_OverflowError, "timeout is too large");
-            return NULL;
+            return -1;
         }
         /* epoll_wait(2) treats all arbitrary negative numbers the same
            for the timeout argument, but -1 is the documented way to block
@@ -1569,22 +1551,6 @@ select_epoll_poll_impl(pyEpoll_Object *self, PyObject *timeout_obj,
         }
     }
 
-    if (maxevents == -1) {
-        maxevents = FD_SETSIZE-1;
-    }
-    else if (maxevents < 1) {
-        PyErr_Format(PyExc_ValueError,
-                     "maxevents must be greater than 0, got %d",
-                     maxevents);
-        return NULL;
-    }
-
-    evs = PyMem_New(struct epoll_event, maxevents);
-    if (evs == NULL) {
-        PyErr_NoMemory();
-        return NULL;
-    }
-
     do {
         Py_BEGIN_ALLOW_THREADS
         errno = 0;
@@ -1596,7 +1562,7 @@ select_epoll_poll_impl(pyEpoll_Object *self, PyObject *timeout_obj,
 
         /* poll() was interrupted by a signal */
         if (PyErr_CheckSignals())
-            goto error;
+            return -1;
 
         if (timeout >= 0) {
             timeout = deadline - _PyTime_GetMonotonicClock();
@@ -1611,6 +1577,56 @@ select_epoll_poll_impl(pyEpoll_Object *self, PyObject *timeout_obj,
 
     if (nfds < 0) {
         PyErr_SetFromErrno(PyExc_OSError);
+        return -1;
+    }
+    return nfds;
+}
+
+/*[clinic input]
+select.epoll.poll
+
+    timeout as timeout_obj: object = None
+      the maximum time to wait in seconds (as float);
+      a timeout of None or -1 makes poll wait indefinitely
+    maxevents: int = -1
+      the maximum number of events returned; -1 means no limit
+
+Wait for events on the epoll file descriptor.
+
+Returns a list containing any descriptors that have events to report,
+as a list of (fd, events) 2-tuples.
+[clinic start generated code]*/
+
+static PyObject *
+select_epoll_poll_impl(pyEpoll_Object *self, PyObject *timeout_obj,
+                       int maxevents)
+/*[clinic end generated code: output=e02d121a20246c6c input=33d34a5ea430fd5b]*/
+{
+    int nfds, i;
+    PyObject *elist = NULL, *etuple = NULL;
+    struct epoll_event *evs = NULL;
+
+    if (self->epfd < 0)
+        return pyepoll_err_closed();
+
+    if (maxevents == -1) {
+        maxevents = FD_SETSIZE-1;
+    }
+    else if (maxevents < 1) {
+        PyErr_Format(PyExc_ValueError,
+                     "maxevents must be greater than 0, got %d",
+                     maxevents);
+        return NULL;
+    }
+
+    evs = PyMem_New(struct epoll_event, maxevents);
+    if (evs == NULL) {
+        PyErr_NoMemory();
+        return NULL;
+    }
+
+    nfds = pyepoll_internal_wait(self, timeout_obj, evs, maxevents);
+    if (nfds < 0) {
         goto error;
     }
 
@@ -1633,6 +1649,78 @@ select_epoll_poll_impl(pyEpoll_Object *self, PyObject *timeout_obj,
     return elist;
 }
 
+/* Number of events poll_into() can collect without a heap allocation. */
+#define EPOLL_STACK_EVENTS 64
+
+/*[clinic input]
+select.epoll.poll_into
+
+    buffer: Py_buffer(accept={rwbuffer})
+      a writable buffer receiving (fd, events) pairs of C ints
+    timeout as timeout_obj: object = None
+      the maximum time to wait in seconds (as float);
+      a timeout of None or -1 makes poll wait indefinitely
+
+Wait for events on the epoll file descriptor, storing them in a buffer.
+
+The number of events waited for is limited by the size of the buffer.
+Each event is stored as two consecutive C ints, the file descriptor
+followed by the event mask, as laid out by array.array('i').
+
+Returns the number of events stored.
+[clinic start generated code]*/
+
+static PyObject *
+select_epoll_poll_into_impl(pyEpoll_Object *self, Py_buffer *buffer,
+                            PyObject *timeout_obj)
+/*[clinic end generated code: output=7c6be9e9d75f39d0 input=60d76d55b6eaa158]*/
+{
+    int nfds, i;
+    Py_ssize_t maxevents;
+    struct epoll_event stack_evs[EPOLL_STACK_EVENTS];
+    struct epoll_event *evs = stack_evs;
+    char *out;
+
+    if (self->epfd < 0)
+        return pyepoll_err_closed();
+
+    maxevents = buffer->len / (2 * (Py_ssize_t)sizeof(int));
+    if (maxevents < 1) {
+        PyErr_SetString(PyExc_ValueError,
+                        "buffer is too small to hold an event");
+        return NULL;
+    }
+    maxevents = Py_MIN(maxevents, INT_MAX);
+
+    if (maxevents > EPOLL_STACK_EVENTS) {
+        evs = PyMem_New(struct epoll_event, maxevents);
+        if (evs == NULL) {
+            PyErr_NoMemory();
+            return NULL;
+        }
+    }
+
+    nfds = pyepoll_internal_wait(self, timeout_obj, evs, (int)maxevents);
+
+    /* The buffer may be arbitrarily aligned (e.g. a bytearray slice). */
+    out = (char *)buffer->buf;
+    for (i = 0; i < nfds; i++) {
+        int pair[2];
+        pair[0] = evs[i].data.fd;
+        pair[1] = (int)evs[i].events;
+        memcpy(out, pair, sizeof(pair));
+        out += sizeof(pair);
+    }
+
+    if (evs != stack_evs) {
+        PyMem_Free(evs);
+    }
+    if (nfds < 0) {
+        return NULL;
+    }
+    return PyLong_FromLong(nfds);
+}
+
 
 /*[clinic input]
 select.epoll.__enter__
@@ -2313,6 +2401,7 @@ static PyMethodDef pyepoll_methods[] = {
     SELECT_EPOLL_REGISTER_METHODDEF
     SELECT_EPOLL_UNREGISTER_METHODDEF
     SELECT_EPOLL_POLL_METHODDEF
+    SELECT_EPOLL_POLL_INTO_METHODDEF
     SELECT_EPOLL___ENTER___METHODDEF
     SELECT_EPOLL___EXIT___METHODDEF
     {NULL,      NULL},
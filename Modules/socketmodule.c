@@ -980,6 +980,12 @@ init_sockobject(PySocketSockObject *s,
 #endif
 
     s->sock_proto = proto;
+    s->sock_errqueue_errno = 0;
+#ifdef HAVE_ZEROCOPY_COMPLETIONS
+    s->sock_zerocopy_sends = NULL;
+    s->sock_zerocopy_nsends = s->sock_zerocopy_allocated = 0;
+    s->sock_zerocopy_next = 0;
+#endif
 
     s->errorhandler = &set_error;
 #ifdef SOCK_NONBLOCK
@@ -3128,6 +3134,172 @@ pair (host, port); the host must refer to the local host. For raw packet\n\
 sockets the address is a tuple (ifname, proto [,pkttype [,hatype [,addr]]])");
 
 
+#ifdef HAVE_ZEROCOPY_COMPLETIONS
+/* With MSG_ZEROCOPY, the kernel transmits directly from the caller's
+   memory: the socket keeps the Py_buffer of each such send until
+   zerocopy_completions() reads its completion or the socket is closed. */
+
+/* Return 1 if a send with these flags is a MSG_ZEROCOPY send.  The kernel
+   ignores MSG_ZEROCOPY unless SO_ZEROCOPY is enabled on the socket. */
+static int
+zerocopy_enabled(PySocketSockObject *s, int flags)
+{
+    int on = 0;
+    socklen_t len = sizeof(on);
+
+    if (!(flags & MSG_ZEROCOPY))
+        return 0;
+    if (getsockopt(s->sock_fd, SOL_SOCKET, SO_ZEROCOPY, (void *)&on, &len))
+        return 0;
+    return on != 0;
+}
+
+/* Make room for one more send, so that zerocopy_keep() cannot fail once
+   the data has been sent.  Return -1 with an exception set on failure. */
+static int
+zerocopy_reserve(PySocketSockObject *s)
+{
+    sock_zerocopy_send *sends;
+    Py_ssize_t allocated;
+
+    if (s->sock_zerocopy_nsends < s->sock_zerocopy_allocated)
+        return 0;
+    allocated = s->sock_zerocopy_allocated ?
+        2 * s->sock_zerocopy_allocated : 8;
+    if ((size_t)allocated > PY_SSIZE_T_MAX / sizeof(sock_zerocopy_send)) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    sends = PyMem_Realloc(s->sock_zerocopy_sends,
+                          allocated * sizeof(sock_zerocopy_send));
+    if (sends == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    s->sock_zerocopy_sends = sends;
+    s->sock_zerocopy_allocated = allocated;
+    return 0;
+}
+
+static void
+zerocopy_release(sock_zerocopy_send *send)
+{
+    Py_ssize_t i;
+
+    for (i = 0; i < send->nbufs; i++)
+        PyBuffer_Release(&send->bufs[i]);
+    PyMem_Free(send->bufs);
+}
+
+/* Keep the nbufs buffers of a send call which made nsyscalls successful
+   MSG_ZEROCOPY system calls.  Steals the buffers and the bufs array,
+   which must have been allocated with PyMem_Malloc().
+   zerocopy_reserve() must have been called before the system calls. */
+static void
+zerocopy_keep(PySocketSockObject *s, Py_buffer *bufs, Py_ssize_t nbufs,
+              uint32_t nsyscalls)
+{
+    sock_zerocopy_send *send;
+
+    if (nsyscalls == 0) {
+        sock_zerocopy_send unused = {0, 0, 0, nbufs, bufs};
+        zerocopy_release(&unused);
+        return;
+    }
+    assert(s->sock_zerocopy_nsends < s->sock_zerocopy_allocated);
+    send = &s->sock_zerocopy_sends[s->sock_zerocopy_nsends++];
+    send->first = s->sock_zerocopy_next;
+    send->count = send->pending = nsyscalls;
+    send->nbufs = nbufs;
+    send->bufs = bufs;
+    s->sock_zerocopy_next += nsyscalls;
+}
+
+/* Release the buffers of the sends whose system calls have all completed,
+   the kernel having reported system calls first through last inclusive. */
+static void
+zerocopy_complete(PySocketSockObject *s, uint32_t first, uint32_t last)
+{
+    uint32_t span = last - first, offset, done;
+    Py_ssize_t i = 0;
+
+    while (i < s->sock_zerocopy_nsends) {
+        sock_zerocopy_send send = s->sock_zerocopy_sends[i];
+
+        /* The counter wraps around: compare offsets, not numbers. */
+        offset = send.first - first;
+        if (offset <= span)
+            done = Py_MIN(send.count, span - offset + 1);
+        else {
+            offset = first - send.first;
+            done = (offset < send.count) ?
+                Py_MIN(send.count - offset, span + 1) : 0;
+        }
+        done = Py_MIN(done, send.pending);
+        if (done < send.pending) {
+            s->sock_zerocopy_sends[i++].pending -= done;
+            continue;
+        }
+        /* Remove the send before releasing its buffers, which may run
+           arbitrary code. */
+        memmove(&s->sock_zerocopy_sends[i], &s->sock_zerocopy_sends[i + 1],
+                (s->sock_zerocopy_nsends - i - 1) *
+                sizeof(sock_zerocopy_send));
+        s->sock_zerocopy_nsends--;
+        zerocopy_release(&send);
+    }
+}
+
+/* Release the buffers of all the sends, when the socket is closed. */
+static void
+zerocopy_release_all(PySocketSockObject *s)
+{
+    sock_zerocopy_send *sends = s->sock_zerocopy_sends;
+    Py_ssize_t i, nsends = s->sock_zerocopy_nsends;
+
+    s->sock_zerocopy_sends = NULL;
+    s->sock_zerocopy_nsends = s->sock_zerocopy_allocated = 0;
+    for (i = 0; i < nsends; i++)
+        zerocopy_release(&sends[i]);
+    PyMem_Free(sends);
+}
+
+/* Prepare a send of a single buffer: set *zcbuf to room for the buffer
+   if it is a MSG_ZEROCOPY send, or to NULL. */
+static int
+zerocopy_prepare(PySocketSockObject *s, int flags, Py_buffer **zcbuf)
+{
+    *zcbuf = NULL;
+    if (!zerocopy_enabled(s, flags))
+        return 0;
+    if (zerocopy_reserve(s) < 0)
+        return -1;
+    if ((*zcbuf = PyMem_New(Py_buffer, 1)) == NULL) {
+        PyErr_NoMemory();
+        return -1;
+    }
+    return 0;
+}
+
+/* Release the buffer of a send prepared by zerocopy_prepare(), or keep it
+   until the completion of the nsyscalls MSG_ZEROCOPY system calls made. */
+static void
+zerocopy_finish(PySocketSockObject *s, Py_buffer *zcbuf, Py_buffer *pbuf,
+                uint32_t nsyscalls)
+{
+    if (zcbuf == NULL) {
+        PyBuffer_Release(pbuf);
+        return;
+    }
+    *zcbuf = *pbuf;
+    zerocopy_keep(s, zcbuf, 1, nsyscalls);
+}
+#else
+#define zerocopy_prepare(s, flags, zcbuf) (*(zcbuf) = NULL, 0)
+#define zerocopy_finish(s, zcbuf, pbuf, nsyscalls) PyBuffer_Release(pbuf)
+#endif    /* HAVE_ZEROCOPY_COMPLETIONS */
+
+
 /* s.close() method.
    Set the file descriptor to -1 so operations tried subsequently
    will surely fail. */
@@ -3151,6 +3323,9 @@ sock_close(PySocketSockObject *s, PyObject *Py_UNUSED(ignored))
         Py_END_ALLOW_THREADS
         /* bpo-30319: The peer can already have closed the connection.
            Python ignores ECONNRESET on close(). */
+#ifdef HAVE_ZEROCOPY_COMPLETIONS
+        zerocopy_release_all(s);
+#endif
         if (res < 0 && errno != ECONNRESET) {
             return s->errorhandler();
         }
@@ -3168,6 +3343,9 @@ sock_detach(PySocketSockObject *s, PyObject *Py_UNUSED(ignored))
 {
     SOCKET_T fd = s->sock_fd;
     s->sock_fd = INVALID_SOCKET;
+#ifdef HAVE_ZEROCOPY_COMPLETIONS
+    zerocopy_release_all(s);
+#endif
     return PyLong_FromSocket_t(fd);
 }
 
@@ -4138,7 +4316,7 @@ static PyObject *
 sock_send(PySocketSockObject *s, PyObject *args)
 {
     int flags = 0;
-    Py_buffer pbuf;
+    Py_buffer pbuf, *zcbuf;
     struct sock_send ctx;
 
     if (!PyArg_ParseTuple(args, "y*|i:send", &pbuf, &flags))
@@ -4148,14 +4326,18 @@ sock_send(PySocketSockObject *s, PyObject *args)
         PyBuffer_Release(&pbuf);
         return select_error();
     }
+    if (zerocopy_prepare(s, flags, &zcbuf) < 0) {
+        PyBuffer_Release(&pbuf);
+        return NULL;
+    }
     ctx.buf = pbuf.buf;
     ctx.len = pbuf.len;
     ctx.flags = flags;
     if (sock_call(s, 1, sock_send_impl, &ctx) < 0) {
-        PyBuffer_Release(&pbuf);
+        zerocopy_finish(s, zcbuf, &pbuf, 0);
         return NULL;
     }
-    PyBuffer_Release(&pbuf);
+    zerocopy_finish(s, zcbuf, &pbuf, pbuf.len > 0);
 
     return PyLong_FromSsize_t(ctx.result);
 }
@@ -4176,7 +4358,8 @@ sock_sendall(PySocketSockObject *s, PyObject *args)
     char *buf;
     Py_ssize_t len, n;
     int flags = 0;
-    Py_buffer pbuf;
+    Py_buffer pbuf, *zcbuf;
+    uint32_t nsyscalls = 0;
     struct sock_send ctx;
     int has_timeout = (s->sock_timeout > 0);
     _PyTime_t interval = s->sock_timeout;
@@ -4193,6 +4376,10 @@ sock_sendall(PySocketSockObject *s, PyObject *args)
         PyBuffer_Release(&pbuf);
         return select_error();
     }
+    if (zerocopy_prepare(s, flags, &zcbuf) < 0) {
+        PyBuffer_Release(&pbuf);
+        return NULL;
+    }
 
     do {
         if (has_timeout) {
@@ -4218,6 +4405,8 @@ sock_sendall(PySocketSockObject *s, PyObject *args)
             goto done;
         n = ctx.result;
         assert(n >= 0);
+        if (len > 0)
+            nsyscalls++;
 
         buf += n;
         len -= n;
@@ -4228,13 +4417,12 @@ sock_sendall(PySocketSockObject *s, PyObject *args)
         if (PyErr_CheckSignals())
             goto done;
     } while (len > 0);
-    PyBuffer_Release(&pbuf);
 
     Py_INCREF(Py_None);
     res = Py_None;
 
 done:
-    PyBuffer_Release(&pbuf);
+    zerocopy_finish(s, zcbuf, &pbuf, nsyscalls);
     return res;
 }
 
@@ -4278,7 +4466,7 @@ sock_sendto_impl(PySocketSockObject *s, void *data)
 static PyObject *
 sock_sendto(PySocketSockObject *s, PyObject *args)
 {
-    Py_buffer pbuf;
+    Py_buffer pbuf, *zcbuf;
     PyObject *addro;
     Py_ssize_t arglen;
     sock_addr_t addrbuf;
@@ -4320,16 +4508,20 @@ sock_sendto(PySocketSockObject *s, PyObject *args)
         return NULL;
     }
 
+    if (zerocopy_prepare(s, flags, &zcbuf) < 0) {
+        PyBuffer_Release(&pbuf);
+        return NULL;
+    }
     ctx.buf = pbuf.buf;
     ctx.len = pbuf.len;
     ctx.flags = flags;
     ctx.addrlen = addrlen;
     ctx.addrbuf = &addrbuf;
     if (sock_call(s, 1, sock_sendto_impl, &ctx) < 0) {
-        PyBuffer_Release(&pbuf);
+        zerocopy_finish(s, zcbuf, &pbuf, 0);
         return NULL;
     }
-    PyBuffer_Release(&pbuf);
+    zerocopy_finish(s, zcbuf, &pbuf, pbuf.len > 0);
 
     return PyLong_FromSsize_t(ctx.result);
 }
@@ -4436,6 +4628,9 @@ sock_sendmsg(PySocketSockObject *s, PyObject *args)
     PyObject *data_arg, *cmsg_arg = NULL, *addr_arg = NULL,
         *cmsg_fast = NULL, *retval = NULL;
     struct sock_sendmsg ctx;
+#ifdef HAVE_ZEROCOPY_COMPLETIONS
+    int zerocopy = 0;
+#endif
 
     if (!PyArg_ParseTuple(args, "O|OiO:sendmsg",
                           &data_arg, &cmsg_arg, &flags, &addr_arg)) {
@@ -4582,11 +4777,31 @@ sock_sendmsg(PySocketSockObject *s, PyObject *args)
         goto finally;
     }
 
+#ifdef HAVE_ZEROCOPY_COMPLETIONS
+    if (zerocopy_enabled(s, flags)) {
+        if (zerocopy_reserve(s) < 0)
+            goto finally;
+        zerocopy = 1;
+    }
+#endif
     ctx.msg = &msg;
     ctx.flags = flags;
     if (sock_call(s, 1, sock_sendmsg_impl, &ctx) < 0)
         goto finally;
 
+#ifdef HAVE_ZEROCOPY_COMPLETIONS
+    if (zerocopy) {
+        uint32_t nsyscalls = 0;
+
+        for (i = 0; i < ndatabufs; i++) {
+            if (databufs[i].len > 0)
+                nsyscalls = 1;
+        }
+        zerocopy_keep(s, databufs, ndatabufs, nsyscalls);
+        databufs = NULL;
+        ndatabufs = 0;
+    }
+#endif
     retval = PyLong_FromSsize_t(ctx.result);
 
 finally:
@@ -4787,6 +5002,404 @@ Set operation mode, IV and length of associated data for an AF_ALG\n\
 operation socket.");
 #endif
 
+#ifdef HAVE_RECVMMSG
+struct sock_recvmmsg {
+    struct mmsghdr *msgvec;
+    unsigned int vlen;
+    int flags;
+    int result;
+};
+
+static int
+sock_recvmmsg_impl(PySocketSockObject *s, void *data)
+{
+    struct sock_recvmmsg *ctx = data;
+
+    ctx->result = recvmmsg(s->sock_fd, ctx->msgvec, ctx->vlen, ctx->flags,
+                           NULL);
+    return (ctx->result >= 0);
+}
+
+/* s.recvmmsg_into(buffers[, flags]) method */
+
+static PyObject *
+sock_recvmmsg_into(PySocketSockObject *s, PyObject *args)
+{
+    int flags = 0;
+    socklen_t addrbuflen;
+    struct mmsghdr *msgvec = NULL;
+    struct iovec *iovs = NULL;
+    sock_addr_t *addrbufs = NULL;
+    Py_ssize_t i, nitems, nbufs = 0;
+    Py_buffer *bufs = NULL;
+    PyObject *buffers_arg, *fast, *retval = NULL;
+    struct sock_recvmmsg ctx;
+
+    if (!PyArg_ParseTuple(args, "O|i:recvmmsg_into", &buffers_arg, &flags))
+        return NULL;
+
+    if (!getsockaddrlen(s, &addrbuflen))
+        return NULL;
+
+    if ((fast = PySequence_Fast(buffers_arg,
+                                "recvmmsg_into() argument 1 must be an "
+                                "iterable")) == NULL)
+        return NULL;
+    nitems = PySequence_Fast_GET_SIZE(fast);
+    if (nitems > INT_MAX) {
+        PyErr_SetString(PyExc_OSError,
+                        "recvmmsg_into() argument 1 is too long");
+        goto finally;
+    }
+    if (nitems == 0) {
+        retval = PyList_New(0);
+        goto finally;
+    }
+
+    /* One message header, iovec and address buffer per datagram. */
+    if ((msgvec = PyMem_New(struct mmsghdr, nitems)) == NULL ||
+        (iovs = PyMem_New(struct iovec, nitems)) == NULL ||
+        (addrbufs = PyMem_New(sock_addr_t, nitems)) == NULL ||
+        (bufs = PyMem_New(Py_buffer, nitems)) == NULL) {
+        PyErr_NoMemory();
+        goto finally;
+    }
+    memset(msgvec, 0, nitems * sizeof(struct mmsghdr));
+    for (; nbufs < nitems; nbufs++) {
+        if (!PyArg_Parse(PySequence_Fast_GET_ITEM(fast, nbufs),
+                         "w*;recvmmsg_into() argument 1 must be an iterable "
+                         "of single-segment read-write buffers",
+                         &bufs[nbufs]))
+            goto finally;
+        iovs[nbufs].iov_base = bufs[nbufs].buf;
+        iovs[nbufs].iov_len = bufs[nbufs].len;
+        /* See the comment in sock_recvmsg_guts() about connected
+           sockets. */
+        memset(&addrbufs[nbufs], 0, addrbuflen);
+        SAS2SA(&addrbufs[nbufs])->sa_family = AF_UNSPEC;
+        msgvec[nbufs].msg_hdr.msg_name = SAS2SA(&addrbufs[nbufs]);
+        msgvec[nbufs].msg_hdr.msg_namelen = addrbuflen;
+        msgvec[nbufs].msg_hdr.msg_iov = &iovs[nbufs];
+        msgvec[nbufs].msg_hdr.msg_iovlen = 1;
+    }
+
+    if (!IS_SELECTABLE(s)) {
+        select_error();
+        goto finally;
+    }
+
+    ctx.msgvec = msgvec;
+    ctx.vlen = (unsigned int)nitems;
+    ctx.flags = flags;
+#ifdef MSG_WAITFORONE
+    /* Return as soon as one datagram has arrived on a blocking socket
+       instead of waiting until every buffer has been filled. */
+    ctx.flags |= MSG_WAITFORONE;
+#endif
+    if (sock_call(s, 0, sock_recvmmsg_impl, &ctx) < 0)
+        goto finally;
+
+    if ((retval = PyList_New(ctx.result)) == NULL)
+        goto finally;
+    for (i = 0; i < ctx.result; i++) {
+        struct msghdr *hdr = &msgvec[i].msg_hdr;
+        PyObject *item = Py_BuildValue(
+            "INi", msgvec[i].msg_len,
+            makesockaddr(s->sock_fd, SAS2SA(&addrbufs[i]),
+                         ((hdr->msg_namelen > addrbuflen) ?
+                          addrbuflen : hdr->msg_namelen),
+                         s->sock_proto),
+            hdr->msg_flags);
+        if (item == NULL) {
+            Py_CLEAR(retval);
+            goto finally;
+        }
+        PyList_SET_ITEM(retval, i, item);
+    }
+
+finally:
+    for (i = 0; i < nbufs; i++)
+        PyBuffer_Release(&bufs[i]);
+    PyMem_Free(bufs);
+    PyMem_Free(addrbufs);
+    PyMem_Free(iovs);
+    PyMem_Free(msgvec);
+    Py_DECREF(fast);
+    return retval;
+}
+
+PyDoc_STRVAR(recvmmsg_into_doc,
+"recvmmsg_into(buffers[, flags]) -> [(nbytes, address, msg_flags), ...]\n\
+\n\
+Receive several datagrams with a single system call.  The buffers\n\
+argument must be an iterable of objects that export writable buffers\n\
+(e.g. bytearray objects); each datagram is written into the next\n\
+buffer and truncated if it does not fit.  The call returns once at\n\
+least one datagram has been received.  The flags argument defaults to\n\
+0 and has the same meaning as for recv().\n\
+\n\
+The return value is a list with one (nbytes, address, msg_flags) tuple\n\
+for each datagram received, in the order of the buffers they were\n\
+written to.  msg_flags is as for recvmsg(); MSG_TRUNC is set in it if\n\
+the datagram was truncated.");
+#endif    /* HAVE_RECVMMSG */
+
+#ifdef HAVE_SENDMMSG
+struct sock_sendmmsg {
+    struct mmsghdr *msgvec;
+    unsigned int vlen;
+    int flags;
+    int result;
+};
+
+static int
+sock_sendmmsg_impl(PySocketSockObject *s, void *data)
+{
+    struct sock_sendmmsg *ctx = data;
+
+    ctx->result = sendmmsg(s->sock_fd, ctx->msgvec, ctx->vlen, ctx->flags);
+    return (ctx->result >= 0);
+}
+
+/* s.sendmmsg(buffers[, flags[, address]]) method */
+
+static PyObject *
+sock_sendmmsg(PySocketSockObject *s, PyObject *args)
+{
+    int addrlen = 0, flags = 0;
+    sock_addr_t addrbuf;
+    struct mmsghdr *msgvec = NULL;
+    struct iovec *iovs = NULL;
+    Py_ssize_t i, nitems, nbufs = 0;
+    Py_buffer *bufs = NULL;
+    PyObject *buffers_arg, *addr_arg = NULL, *fast = NULL, *retval = NULL;
+    struct sock_sendmmsg ctx;
+#ifdef HAVE_ZEROCOPY_COMPLETIONS
+    int zerocopy = 0;
+#endif
+
+    if (!PyArg_ParseTuple(args, "O|iO:sendmmsg",
+                          &buffers_arg, &flags, &addr_arg))
+        return NULL;
+
+    if (addr_arg != NULL && addr_arg != Py_None) {
+        if (!getsockaddrarg(s, addr_arg, &addrbuf, &addrlen, "sendmmsg"))
+            return NULL;
+    }
+    else {
+        addr_arg = Py_None;
+    }
+    if (PySys_Audit("socket.sendmmsg", "OO", s, addr_arg) < 0)
+        return NULL;
+
+    if ((fast = PySequence_Fast(buffers_arg,
+                                "sendmmsg() argument 1 must be an "
+                                "iterable")) == NULL)
+        return NULL;
+    nitems = PySequence_Fast_GET_SIZE(fast);
+    if (nitems > INT_MAX) {
+        PyErr_SetString(PyExc_OSError, "sendmmsg() argument 1 is too long");
+        goto finally;
+    }
+    if (nitems == 0) {
+        retval = PyLong_FromLong(0);
+        goto finally;
+    }
+
+    if ((msgvec = PyMem_New(struct mmsghdr, nitems)) == NULL ||
+        (iovs = PyMem_New(struct iovec, nitems)) == NULL ||
+        (bufs = PyMem_New(Py_buffer, nitems)) == NULL) {
+        PyErr_NoMemory();
+        goto finally;
+    }
+    memset(msgvec, 0, nitems * sizeof(struct mmsghdr));
+    for (; nbufs < nitems; nbufs++) {
+        if (!PyArg_Parse(PySequence_Fast_GET_ITEM(fast, nbufs),
+                         "y*;sendmmsg() argument 1 must be an iterable of "
+                         "bytes-like objects",
+                         &bufs[nbufs]))
+            goto finally;
+        iovs[nbufs].iov_base = bufs[nbufs].buf;
+        iovs[nbufs].iov_len = bufs[nbufs].len;
+        if (addrlen > 0) {
+            msgvec[nbufs].msg_hdr.msg_name = SAS2SA(&addrbuf);
+            msgvec[nbufs].msg_hdr.msg_namelen = addrlen;
+        }
+        msgvec[nbufs].msg_hdr.msg_iov = &iovs[nbufs];
+        msgvec[nbufs].msg_hdr.msg_iovlen = 1;
+    }
+
+    if (!IS_SELECTABLE(s)) {
+        select_error();
+        goto finally;
+    }
+
+#ifdef HAVE_ZEROCOPY_COMPLETIONS
+    if (zerocopy_enabled(s, flags)) {
+        if (zerocopy_reserve(s) < 0)
+            goto finally;
+        zerocopy = 1;
+    }
+#endif
+    ctx.msgvec = msgvec;
+    ctx.vlen = (unsigned int)nitems;
+    ctx.flags = flags;
+    if (sock_call(s, 1, sock_sendmmsg_impl, &ctx) < 0)
+        goto finally;
+
+#ifdef HAVE_ZEROCOPY_COMPLETIONS
+    if (zerocopy) {
+        /* Each non-empty datagram sent is a MSG_ZEROCOPY system call. */
+        uint32_t nsyscalls = 0;
+
+        for (i = 0; i < ctx.result; i++) {
+            if (bufs[i].len > 0)
+                nsyscalls++;
+        }
+        zerocopy_keep(s, bufs, nbufs, nsyscalls);
+        bufs = NULL;
+        nbufs = 0;
+    }
+#endif
+    retval = PyLong_FromLong(ctx.result);
+
+finally:
+    for (i = 0; i < nbufs; i++)
+        PyBuffer_Release(&bufs[i]);
+    PyMem_Free(bufs);
+    PyMem_Free(iovs);
+    PyMem_Free(msgvec);
+    Py_DECREF(fast);
+    return retval;
+}
+
+PyDoc_STRVAR(sendmmsg_doc,
+"sendmmsg(buffers[, flags[, address]]) -> count\n\
+\n\
+Send several datagrams with a single system call.  The buffers\n\
+argument is an iterable of bytes-like objects, each of which is sent\n\
+as a separate datagram.  The flags argument defaults to 0 and has the\n\
+same meaning as for send().  If address is supplied and not None, it\n\
+sets the destination address of every datagram.  The return value is\n\
+the number of datagrams sent, which may be less than the number of\n\
+buffers.");
+#endif    /* HAVE_SENDMMSG */
+
+#ifdef HAVE_ZEROCOPY_COMPLETIONS
+/* s.zerocopy_completions() method */
+
+static PyObject *
+sock_zerocopy_completions(PySocketSockObject *s, PyObject *Py_UNUSED(ignored))
+{
+    /* Room for the sock_extended_err and the offending address. */
+    union {
+        struct cmsghdr align;
+        char buf[CMSG_SPACE(sizeof(struct sock_extended_err) +
+                            sizeof(struct sockaddr_in6))];
+    } control;
+    struct msghdr msg;
+    struct cmsghdr *cmsg;
+    struct sock_extended_err *ee;
+    PyObject *list, *item;
+    ssize_t res;
+
+    /* An error met while completions were being collected by the
+       previous call: they have been returned, report it now. */
+    if (s->sock_errqueue_errno != 0) {
+        errno = s->sock_errqueue_errno;
+        s->sock_errqueue_errno = 0;
+        return s->errorhandler();
+    }
+
+    list = PyList_New(0);
+    if (list == NULL)
+        return NULL;
+
+    for (;;) {
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_control = control.buf;
+        msg.msg_controllen = sizeof(control.buf);
+
+        Py_BEGIN_ALLOW_THREADS
+        res = recvmsg(s->sock_fd, &msg, MSG_ERRQUEUE | MSG_DONTWAIT);
+        Py_END_ALLOW_THREADS
+        if (res < 0) {
+            if (errno == EAGAIN || errno == EWOULDBLOCK)
+                break;
+            if (errno == EINTR) {
+                if (PyErr_CheckSignals())
+                    goto error;
+                continue;
+            }
+            goto queue_error;
+        }
+
+        for (cmsg = CMSG_FIRSTHDR(&msg); cmsg != NULL;
+             cmsg = CMSG_NXTHDR(&msg, cmsg)) {
+            if (!(cmsg->cmsg_level == IPPROTO_IP &&
+                  cmsg->cmsg_type == IP_RECVERR)
+#ifdef ENABLE_IPV6
+                && !(cmsg->cmsg_level == IPPROTO_IPV6 &&
+                     cmsg->cmsg_type == IPV6_RECVERR)
+#endif
+                )
+                continue;
+            ee = (struct sock_extended_err *)CMSG_DATA(cmsg);
+            if (ee->ee_origin != SO_EE_ORIGIN_ZEROCOPY) {
+                /* Some other queued error (e.g. an ICMP error on a
+                   socket with IP_RECVERR set): report it. */
+                if (ee->ee_errno != 0) {
+                    errno = ee->ee_errno;
+                    goto queue_error;
+                }
+                continue;
+            }
+            zerocopy_complete(s, ee->ee_info, ee->ee_data);
+            item = Py_BuildValue("kkO",
+                                 (unsigned long)ee->ee_info,
+                                 (unsigned long)ee->ee_data,
+                                 (ee->ee_code & SO_EE_CODE_ZEROCOPY_COPIED) ?
+                                     Py_True : Py_False);
+            if (item == NULL)
+                goto error;
+            if (PyList_Append(list, item) < 0) {
+                Py_DECREF(item);
+                goto error;
+            }
+            Py_DECREF(item);
+        }
+    }
+    return list;
+
+queue_error:
+    /* The completions read so far have been removed from the error
+       queue: return them and keep the error for the next call. */
+    if (PyList_GET_SIZE(list) > 0) {
+        s->sock_errqueue_errno = errno;
+        return list;
+    }
+    s->errorhandler();
+error:
+    Py_DECREF(list);
+    return NULL;
+}
+
+PyDoc_STRVAR(zerocopy_completions_doc,
+"zerocopy_completions() -> list of (first, last, copied) tuples\n\
+\n\
+Read the pending MSG_ZEROCOPY completion notifications from the\n\
+socket's error queue without blocking.  Every send() or sendmsg() call\n\
+made with MSG_ZEROCOPY is numbered, starting from zero; each tuple\n\
+reports that the kernel has released the buffers of calls first\n\
+through last inclusive, which the socket then releases as well.\n\
+copied is true if the kernel fell back to copying the data.  Returns\n\
+an empty list if no notification is pending.\n\
+\n\
+Other errors found on the queue (with IP_RECVERR) are raised as OSError;\n\
+if completions were read first, they are returned and the error is\n\
+raised by the next call.");
+#endif    /* HAVE_ZEROCOPY_COMPLETIONS */
+
 /* s.shutdown(how) method */
 
 static PyObject *
@@ -4966,6 +5579,18 @@ static PyMethodDef sock_methods[] = {
     {"sendmsg",           (PyCFunction)sock_sendmsg, METH_VARARGS,
                       sendmsg_doc},
 #endif
+#ifdef HAVE_RECVMMSG
+    {"recvmmsg_into",     (PyCFunction)sock_recvmmsg_into, METH_VARARGS,
+                      recvmmsg_into_doc},
+#endif
+#ifdef HAVE_SENDMMSG
+    {"sendmmsg",          (PyCFunction)sock_sendmmsg, METH_VARARGS,
+                      sendmmsg_doc},
+#endif
+#ifdef HAVE_ZEROCOPY_COMPLETIONS
+    {"zerocopy_completions", (PyCFunction)sock_zerocopy_completions,
+                      METH_NOARGS, zerocopy_completions_doc},
+#endif
 #ifdef HAVE_SOCKADDR_ALG
     {"sendmsg_afalg",     (PyCFunction)(void(*)(void))sock_sendmsg_afalg, METH_VARARGS | METH_KEYWORDS,
                       sendmsg_afalg_doc},
@@ -5018,6 +5643,9 @@ sock_finalize(PySocketSockObject *s)
         (void) SOCKETCLOSE(fd);
         Py_END_ALLOW_THREADS
     }
+#ifdef HAVE_ZEROCOPY_COMPLETIONS
+    zerocopy_release_all(s);
+#endif
 
     /* Restore the saved exception. */
     PyErr_Restore(error_type, error_value, error_traceback);
@@ -7565,6 +8193,9 @@ PyInit__socket(void)
 #ifdef  SO_MARK
     PyModule_AddIntMacro(m, SO_MARK);
 #endif
+#ifdef  SO_ZEROCOPY
+    PyModule_AddIntMacro(m, SO_ZEROCOPY);
+#endif
 #ifdef SO_DOMAIN
     PyModule_AddIntMacro(m, SO_DOMAIN);
 #endif
@@ -7636,6 +8267,9 @@ PyInit__socket(void)
 #ifdef  MSG_CONFIRM
     PyModule_AddIntMacro(m, MSG_CONFIRM);
 #endif
+#ifdef  MSG_ZEROCOPY
+    PyModule_AddIntMacro(m, MSG_ZEROCOPY);
+#endif
 #ifdef  MSG_MORE
     PyModule_AddIntMacro(m, MSG_MORE);
 #endif
@@ -8021,6 +8655,9 @@ PyInit__socket(void)
 #ifdef  IP_RECVRETOPTS
     PyModule_AddIntMacro(m, IP_RECVRETOPTS);
 #endif
+#ifdef  IP_RECVERR
+    PyModule_AddIntMacro(m, IP_RECVERR);
+#endif
 #ifdef  IP_RECVDSTADDR
     PyModule_AddIntMacro(m, IP_RECVDSTADDR);
 #endif
@@ -8133,6 +8770,9 @@ PyInit__socket(void)
 #ifdef IPV6_RECVPATHMTU
     PyModule_AddIntMacro(m, IPV6_RECVPATHMTU);
 #endif
+#ifdef IPV6_RECVERR
+    PyModule_AddIntMacro(m, IPV6_RECVERR);
+#endif
 #ifdef IPV6_TCLASS
     PyModule_AddIntMacro(m, IPV6_TCLASS);
 #endif
@@ -155,6 +155,14 @@ typedef int socklen_t;
 #include <sys/kern_control.h>
 #endif
 
+#ifdef HAVE_LINUX_ERRQUEUE_H
+# include <linux/errqueue.h>
+# if defined(SO_EE_ORIGIN_ZEROCOPY) && defined(MSG_ERRQUEUE) && \
+     defined(SO_ZEROCOPY) && defined(MSG_ZEROCOPY)
+#  define HAVE_ZEROCOPY_COMPLETIONS
+# endif
+#endif
+
 #ifdef HAVE_LINUX_VM_SOCKETS_H
 # include <linux/vm_sockets.h>
 #else
@@ -275,6 +283,19 @@ typedef union sock_addr {
 #endif
 } sock_addr_t;
 
+#ifdef HAVE_ZEROCOPY_COMPLETIONS
+/* The buffers of a MSG_ZEROCOPY send call, kept until the kernel reports
+   that it no longer uses them.  Each successful system call made with
+   MSG_ZEROCOPY gets the next number of a 32-bit counter. */
+typedef struct {
+    uint32_t first;             /* Number of the first system call */
+    uint32_t count;             /* Number of system calls made */
+    uint32_t pending;           /* Number of them not completed yet */
+    Py_ssize_t nbufs;
+    Py_buffer *bufs;            /* Allocated with PyMem_Malloc() */
+} sock_zerocopy_send;
+#endif
+
 /* The object holding a socket.  It holds some extra information,
    like the address family, which is used to decode socket address
    arguments properly. */
@@ -290,6 +311,17 @@ typedef struct {
                                         sets a Python exception */
     _PyTime_t sock_timeout;     /* Operation timeout in seconds;
                                         0.0 means non-blocking */
+    int sock_errqueue_errno;    /* Error read from the error queue by
+                                   zerocopy_completions() but not yet
+                                   reported, or 0 */
+#ifdef HAVE_ZEROCOPY_COMPLETIONS
+    sock_zerocopy_send *sock_zerocopy_sends; /* Sends not completed yet,
+                                                oldest first */
+    Py_ssize_t sock_zerocopy_nsends;
+    Py_ssize_t sock_zerocopy_allocated;
+    uint32_t sock_zerocopy_next; /* Number of the next MSG_ZEROCOPY
+                                    system call */
+#endif
 } PySocketSockObject;
 
 /* --- C API ----------------------------------------------------*/
@@ -1315,6 +1315,42 @@ zlib_crc32_impl(PyObject *module, Py_buffer *data, unsigned int value)
     return PyLong_FromUnsignedLong(signed_val & 0xffffffffU);
 }
 
+/*[clinic input]
+zlib.crc32_combine
+
+    crc1: unsigned_int(bitwise=True)
+        CRC-32 checksum of a first sequence of bytes.
+    crc2: unsigned_int(bitwise=True)
+        CRC-32 checksum of a second sequence of bytes.
+    length2: Py_ssize_t
+        Length of the second sequence.
+    /
+
+Return the CRC-32 checksum of the concatenation of two sequences.
+
+This allows computing the checksums of parts of some data separately, for
+example in parallel, and combining them.
+[clinic start generated code]*/
+
+static PyObject *
+zlib_crc32_combine_impl(PyObject *module, unsigned int crc1,
+                        unsigned int crc2, Py_ssize_t length2)
+/*[clinic end generated code: output=0e2576429a7358e0 input=1f143635e316ba31]*/
+{
+    z_off_t len2 = (z_off_t)length2;
+
+    if (length2 < 0) {
+        PyErr_SetString(PyExc_ValueError, "length2 must not be negative");
+        return NULL;
+    }
+    if (len2 != length2) {
+        PyErr_SetString(PyExc_OverflowError, "length2 is too large");
+        return NULL;
+    }
+    crc1 = crc32_combine(crc1, crc2, len2);
+    return PyLong_FromUnsignedLong(crc1 & 0xffffffffU);
+}
+
 
 static PyMethodDef zlib_methods[] =
 {
@@ -1322,6 +1358,7 @@ static PyMethodDef zlib_methods[] =
     ZLIB_COMPRESS_METHODDEF
     ZLIB_COMPRESSOBJ_METHODDEF
     ZLIB_CRC32_METHODDEF
+    ZLIB_CRC32_COMBINE_METHODDEF
     ZLIB_DECOMPRESS_METHODDEF
     ZLIB_DECOMPRESSOBJ_METHODDEF
     {NULL, NULL}
@@ -3,6 +3,53 @@
 #include "pycore_abstract.h"   // _PyIndex_Check()
 #include "pycore_bytes_methods.h"
 
+/* Mask to quickly check whether a C 'size_t' contains a
+   non-ASCII, UTF8-encoded char. */
+#if (SIZEOF_SIZE_T == 8)
+# define ASCII_CHAR_MASK 0x8080808080808080ULL
+#elif (SIZEOF_SIZE_T == 4)
+# define ASCII_CHAR_MASK 0x80808080U
+#else
+# error C 'size_t' size should be either 4 or 8!
+#endif
+
+/* Repeat the byte c in every byte of a size_t. */
+#define REPEAT_BYTE(c) ((size_t)(c) * (ASCII_CHAR_MASK >> 7))
+
+/* Classify and convert ASCII a machine word at a time.  Each byte of the
+   word is handled as an independent lane: the additions below can't carry
+   from one byte into the next because the high bit of every byte is
+   cleared first.
+
+   Return a word with the high bit of each byte set if, and only if,
+   lo <= byte <= hi, where 0 < lo <= hi < 0x80.  Non-ASCII bytes are never
+   in range. */
+static inline size_t
+ascii_in_range(size_t w, unsigned char lo, unsigned char hi)
+{
+    size_t low7 = w & ~ASCII_CHAR_MASK;
+    size_t ge_lo = low7 + REPEAT_BYTE(0x80 - lo);
+    size_t gt_hi = low7 + REPEAT_BYTE(0x7f - hi);
+    return ge_lo & ~gt_hi & ~w & ASCII_CHAR_MASK;
+}
+
+static inline size_t
+load_word(const char *p)
+{
+    size_t w;
+    memcpy(&w, p, SIZEOF_SIZE_T);
+    return w;
+}
+
+#define ASCII_ISSPACE_WORD(w) \
+    (ascii_in_range(w, '\t', '\r') | ascii_in_range(w, ' ', ' '))
+#define ASCII_ISALPHA_WORD(w) \
+    ascii_in_range((w) | REPEAT_BYTE(0x20), 'a', 'z')
+#define ASCII_ISDIGIT_WORD(w) \
+    ascii_in_range(w, '0', '9')
+#define ASCII_ISALNUM_WORD(w) \
+    (ASCII_ISALPHA_WORD(w) | ASCII_ISDIGIT_WORD(w))
+
 PyDoc_STRVAR_shared(_Py_isspace__doc__,
 "B.isspace() -> bool\n\
 \n\
@@ -25,6 +72,10 @@ _Py_bytes_isspace(const char *cptr, Py_ssize_t len)
         Py_RETURN_FALSE;
 
     e = p + len;
+    for (; e - p >= SIZEOF_SIZE_T; p += SIZEOF_SIZE_T) {
+        if (ASCII_ISSPACE_WORD(load_word((const char *)p)) != ASCII_CHAR_MASK)
+            Py_RETURN_FALSE;
+    }
     for (; p < e; p++) {
         if (!Py_ISSPACE(*p))
             Py_RETURN_FALSE;
@@ -55,6 +106,10 @@ _Py_bytes_isalpha(const char *cptr, Py_ssize_t len)
         Py_RETURN_FALSE;
 
     e = p + len;
+    for (; e - p >= SIZEOF_SIZE_T; p += SIZEOF_SIZE_T) {
+        if (ASCII_ISALPHA_WORD(load_word((const char *)p)) != ASCII_CHAR_MASK)
+            Py_RETURN_FALSE;
+    }
     for (; p < e; p++) {
         if (!Py_ISALPHA(*p))
             Py_RETURN_FALSE;
@@ -85,6 +140,10 @@ _Py_bytes_isalnum(const char *cptr, Py_ssize_t len)
         Py_RETURN_FALSE;
 
     e = p + len;
+    for (; e - p >= SIZEOF_SIZE_T; p += SIZEOF_SIZE_T) {
+        if (ASCII_ISALNUM_WORD(load_word((const char *)p)) != ASCII_CHAR_MASK)
+            Py_RETURN_FALSE;
+    }
     for (; p < e; p++) {
         if (!Py_ISALNUM(*p))
             Py_RETURN_FALSE;
@@ -100,16 +159,6 @@ Return True if B is empty or all characters in B are ASCII,\n\
 False otherwise.");
 
 // Optimization is copied from ascii_decode in unicodeobject.c
-/* Mask to quickly check whether a C 'size_t' contains a
-   non-ASCII, UTF8-encoded char. */
-#if (SIZEOF_SIZE_T == 8)
-# define ASCII_CHAR_MASK 0x8080808080808080ULL
-#elif (SIZEOF_SIZE_T == 4)
-# define ASCII_CHAR_MASK 0x80808080U
-#else
-# error C 'size_t' size should be either 4 or 8!
-#endif
-
 PyObject*
 _Py_bytes_isascii(const char *cptr, Py_ssize_t len)
 {
@@ -142,7 +191,6 @@ _Py_bytes_isascii(const char *cptr, Py_ssize_t len)
     Py_RETURN_TRUE;
 }
 
-#undef ASCII_CHAR_MASK
 
 
 PyDoc_STRVAR_shared(_Py_isdigit__doc__,
@@ -167,6 +215,10 @@ _Py_bytes_isdigit(const char *cptr, Py_ssize_t len)
         Py_RETURN_FALSE;
 
     e = p + len;
+    for (; e - p >= SIZEOF_SIZE_T; p += SIZEOF_SIZE_T) {
+        if (ASCII_ISDIGIT_WORD(load_word((const char *)p)) != ASCII_CHAR_MASK)
+            Py_RETURN_FALSE;
+    }
     for (; p < e; p++) {
         if (!Py_ISDIGIT(*p))
             Py_RETURN_FALSE;
@@ -302,7 +354,13 @@ _Py_bytes_lower(char *result, const char *cptr, Py_ssize_t len)
 {
     Py_ssize_t i;
 
-    for (i = 0; i < len; i++) {
+    /* Flip the 0x20 bit of the bytes that are in range. */
+    for (i = 0; len - i >= SIZEOF_SIZE_T; i += SIZEOF_SIZE_T) {
+        size_t w = load_word(cptr + i);
+        w ^= ascii_in_range(w, 'A', 'Z') >> 2;
+        memcpy(result + i, &w, SIZEOF_SIZE_T);
+    }
+    for (; i < len; i++) {
         result[i] = Py_TOLOWER((unsigned char) cptr[i]);
     }
 }
@@ -318,7 +376,13 @@ _Py_bytes_upper(char *result, const char *cptr, Py_ssize_t len)
 {
     Py_ssize_t i;
 
-    for (i = 0; i < len; i++) {
+    /* Flip the 0x20 bit of the bytes that are in range. */
+    for (i = 0; len - i >= SIZEOF_SIZE_T; i += SIZEOF_SIZE_T) {
+        size_t w = load_word(cptr + i);
+        w ^= ascii_in_range(w, 'a', 'z') >> 2;
+        memcpy(result + i, &w, SIZEOF_SIZE_T);
+    }
+    for (; i < len; i++) {
         result[i] = Py_TOUPPER((unsigned char) cptr[i]);
     }
 }
@@ -2165,6 +2165,178 @@ unsafe_tuple_compare(PyObject *v, PyObject *w, MergeState *ms)
         return PyObject_RichCompareBool(vt->ob_item[i], wt->ob_item[i], Py_LT);
 }
 
+/* Radix sort for homogeneous lists of bounded ints or floats.
+ *
+ * When the pre-sort check picks unsafe_long_compare or unsafe_float_compare,
+ * every key can be mapped to an unsigned 64-bit integer whose natural order
+ * is the order the compare function would give, and equal keys map to equal
+ * integers.  A stable LSD radix sort on those integers then produces exactly
+ * the permutation timsort would have produced, in time linear in the size of
+ * the list.  It needs O(n) extra memory, and it can't exploit existing order
+ * the way timsort does, so it's only used for large lists that don't look
+ * mostly ordered.
+ */
+
+/* Don't bother for lists shorter than this; timsort is competitive there. */
+#define RADIXSORT_MIN_SIZE 1024
+
+/* The number of (bits per) digits the 64-bit keys are split into. */
+#define RADIXSORT_DIGIT_BITS 8
+#define RADIXSORT_BUCKETS (1 << RADIXSORT_DIGIT_BITS)
+#define RADIXSORT_PASSES (64 / RADIXSORT_DIGIT_BITS)
+
+#if SIZEOF_DOUBLE == 8 && (defined(DOUBLE_IS_LITTLE_ENDIAN_IEEE754) || \
+                           defined(DOUBLE_IS_BIG_ENDIAN_IEEE754))
+#define RADIXSORT_FLOATS
+#endif
+
+/* Map a bounded int to an order-preserving unsigned key. */
+static inline uint64_t
+radixsort_long_key(PyObject *v)
+{
+    PyLongObject *vl = (PyLongObject *)v;
+    int64_t v0;
+
+    assert(Py_ABS(Py_SIZE(vl)) <= 1);
+    v0 = Py_SIZE(vl) == 0 ? 0 : (int64_t)vl->ob_digit[0];
+    if (Py_SIZE(vl) < 0)
+        v0 = -v0;
+    return (uint64_t)v0 ^ ((uint64_t)1 << 63);
+}
+
+#ifdef RADIXSORT_FLOATS
+/* Map a non-NaN float to an order-preserving unsigned key.  -0.0 and 0.0
+ * compare equal, so they must share a key to keep the sort stable.
+ */
+static inline uint64_t
+radixsort_float_key(double d)
+{
+    uint64_t bits;
+
+    if (d == 0.0)
+        d = 0.0;
+    memcpy(&bits, &d, sizeof(bits));
+    if (bits >> 63)
+        return ~bits;
+    return bits | ((uint64_t)1 << 63);
+}
+#endif
+
+/* Sort items[0:n] in place, given that every item is a bounded int (if
+ * is_float is 0) or a float (if is_float is 1).
+ * Return 1 if the items were sorted, or 0 if radix sort declined (NaNs,
+ * mostly ordered input, or not enough memory) and items are untouched,
+ * so the caller should go on to use timsort.  Never sets an exception.
+ */
+static int
+radixsort(PyObject **items, Py_ssize_t n, int is_float)
+{
+    uint64_t *keys, *keys_tmp, *key_buf;
+    PyObject **items_tmp, **item_buf;
+    PyObject **orig_items = items;
+    uint64_t key, prev;
+    Py_ssize_t counts[RADIXSORT_PASSES][RADIXSORT_BUCKETS];
+    Py_ssize_t i, ndescents = 0;
+    int pass;
+
+#ifndef RADIXSORT_FLOATS
+    if (is_float)
+        return 0;
+#endif
+    if ((size_t)n > PY_SSIZE_T_MAX / (2 * sizeof(uint64_t)))
+        return 0;
+    keys = key_buf = PyMem_Malloc(2 * n * sizeof(uint64_t));
+    if (keys == NULL)
+        return 0;
+    keys_tmp = keys + n;
+
+    /* Compute the keys, and count descents to detect ordered input. */
+    prev = 0;
+    for (i = 0; i < n; i++) {
+#ifdef RADIXSORT_FLOATS
+        if (is_float) {
+            double d = PyFloat_AS_DOUBLE(items[i]);
+            if (Py_IS_NAN(d)) {
+                /* NaNs make the "<" order inconsistent; leave them to
+                   timsort so the result is the same as it always was. */
+                PyMem_Free(key_buf);
+                return 0;
+            }
+            key = radixsort_float_key(d);
+        }
+        else
+#endif
+        {
+            key = radixsort_long_key(items[i]);
+        }
+        ndescents += key < prev;
+        keys[i] = prev = key;
+    }
+    if (ndescents == 0) {
+        /* Already sorted. */
+        PyMem_Free(key_buf);
+        return 1;
+    }
+    if (ndescents < n / 64 || ndescents == n - 1) {
+        /* Few long runs, or a descending run timsort would simply
+           reverse.  Timsort is linear or close to it on these. */
+        PyMem_Free(key_buf);
+        return 0;
+    }
+
+    items_tmp = item_buf = PyMem_Malloc(n * sizeof(PyObject *));
+    if (items_tmp == NULL) {
+        PyMem_Free(key_buf);
+        return 0;
+    }
+
+    /* Histogram every digit in a single pass. */
+    memset(counts, 0, sizeof(counts));
+    for (i = 0; i < n; i++) {
+        key = keys[i];
+        for (pass = 0; pass < RADIXSORT_PASSES; pass++) {
+            counts[pass][key & (RADIXSORT_BUCKETS - 1)]++;
+            key >>= RADIXSORT_DIGIT_BITS;
+        }
+    }
+
+    for (pass = 0; pass < RADIXSORT_PASSES; pass++) {
+        Py_ssize_t *count = counts[pass];
+        Py_ssize_t offset = 0, c;
+        int shift = pass * RADIXSORT_DIGIT_BITS;
+        int b;
+        uint64_t *kswap;
+        PyObject **iswap;
+
+        /* Skip digits that are the same in every key; that's typically
+           most of them for small ints. */
+        if (count[(keys[0] >> shift) & (RADIXSORT_BUCKETS - 1)] == n)
+            continue;
+
+        for (b = 0; b < RADIXSORT_BUCKETS; b++) {
+            c = count[b];
+            count[b] = offset;
+            offset += c;
+        }
+        for (i = 0; i < n; i++) {
+            Py_ssize_t dest;
+            key = keys[i];
+            dest = count[(key >> shift) & (RADIXSORT_BUCKETS - 1)]++;
+            keys_tmp[dest] = key;
+            items_tmp[dest] = items[i];
+        }
+        kswap = keys; keys = keys_tmp; keys_tmp = kswap;
+        iswap = items; items = items_tmp; items_tmp = iswap;
+    }
+
+    /* After an odd number of passes the result is in the scratch array. */
+    if (items != orig_items)
+        memcpy(orig_items, items, n * sizeof(PyObject *));
+    PyMem_Free(key_buf);
+    PyMem_Free(item_buf);
+    return 1;
+}
+
 /* An adaptive, stable, natural mergesort.  See listsort.txt.
  * Returns Py_None on success, NULL on error.  Even in case of error, the
  * list will be some permutation of its input state (nothing is lost or
@@ -2364,6 +2536,15 @@ list_sort_impl(PyListObject *self, PyObject *keyfunc, int reverse)
         reverse_slice(&saved_ob_item[0], &saved_ob_item[saved_ob_size]);
     }
 
+    /* Large lists of plain numbers can skip comparisons altogether. */
+    if (keys == NULL && nremaining >= RADIXSORT_MIN_SIZE &&
+        (ms.key_compare == unsafe_long_compare ||
+         ms.key_compare == unsafe_float_compare)) {
+        if (radixsort(saved_ob_item, nremaining,
+                      ms.key_compare == unsafe_float_compare))
+            goto succeed;
+    }
+
     /* March over the array once, left to right, finding natural runs,
      * and extending short natural runs to minrun elements.
      */
@@ -4,7 +4,10 @@
 
 /* fast search/count implementation, based on a mix between boyer-
    moore and horspool, with a few more bells and whistles on the top.
-   for some more background, see: http://effbot.org/zone/stringlib.htm */
+   for some more background, see: http://effbot.org/zone/stringlib.htm.
+   long needles in long haystacks, and inputs on which horspool makes
+   too many comparisons, are handled by the two-way algorithm instead,
+   which is linear in the worst case. */
 
 /* note: fastsearch may access s[n], which isn't a problem when using
    Python's ordinary string types, but may cause problems if you're
@@ -160,119 +163,398 @@ STRINGLIB(rfind_char)(const STRINGLIB_CHAR* s, Py_ssize_t n, STRINGLIB_CHAR ch)
 
 #undef MEMCHR_CUT_OFF
 
-Py_LOCAL_INLINE(Py_ssize_t)
-FASTSEARCH(const STRINGLIB_CHAR* s, Py_ssize_t n,
-           const STRINGLIB_CHAR* p, Py_ssize_t m,
-           Py_ssize_t maxcount, int mode)
-{
-    unsigned long mask;
-    Py_ssize_t skip, count = 0;
-    Py_ssize_t i, j, mlast, w;
+/* The Crochemore-Perrin two-way algorithm, for long needles.
 
-    w = n - m;
+   The needle is split at a "critical factorization" into a left half
+   needle[:cut] and a right half needle[cut:].  Each alignment of the
+   needle against the haystack is checked right half first, left to
+   right, then left half, right to left.  A mismatch in the right half
+   allows a shift by the number of characters matched; a full match of
+   the right half followed by a mismatch in the left half allows a shift
+   by the period of the needle.  The critical factorization guarantees
+   that no occurrence is skipped, and the search runs in O(n + m) time
+   with O(1) extra space -- Horspool, below, is O(n*m) in the worst case.
 
-    if (w < 0 || (mode == FAST_COUNT && maxcount == 0))
-        return -1;
+   See Crochemore and Perrin, "Two-way string-matching", Journal of the
+   ACM, 38(3):651-675, 1991, and the glibc implementation.
 
-    /* look for special cases */
-    if (m <= 1) {
-        if (m <= 0)
-            return -1;
-        /* use special case for 1-character strings */
-        if (mode == FAST_SEARCH)
-            return STRINGLIB(find_char)(s, n, p[0]);
-        else if (mode == FAST_RSEARCH)
-            return STRINGLIB(rfind_char)(s, n, p[0]);
-        else {  /* FAST_COUNT */
-            for (i = 0; i < n; i++)
-                if (s[i] == p[0]) {
-                    count++;
-                    if (count == maxcount)
-                        return maxcount;
-                }
-            return count;
+   A small Horspool-style shift table, indexed by the low bits of each
+   character, is used on top of that to skip quickly over alignments
+   whose last character can't match.
+
+   Reverse searches run the same algorithm on the mirrored needle and
+   haystack: the functions below take a direction dir, and with dir == -1
+   they are passed pointers to the last character and read text[-k]
+   instead of text[k].  No reversed copy of either string is made.
+*/
+
+#define STRINGLIB_TWO_WAY_TABLE_SIZE_BITS 6
+#define STRINGLIB_TWO_WAY_TABLE_SIZE (1U << STRINGLIB_TWO_WAY_TABLE_SIZE_BITS)
+#define STRINGLIB_TWO_WAY_TABLE_MASK (STRINGLIB_TWO_WAY_TABLE_SIZE - 1U)
+
+typedef struct STRINGLIB(_pre) {
+    const STRINGLIB_CHAR *needle;
+    Py_ssize_t len_needle;
+    int dir;
+    Py_ssize_t cut;
+    Py_ssize_t period;
+    int is_periodic;
+    Py_ssize_t table[STRINGLIB_TWO_WAY_TABLE_SIZE];
+} STRINGLIB(prework);
+
+
+/* Find the start of the maximal suffix of needle, under the ordering of
+   characters given by invert (0: '<', 1: '>'), and store the period of
+   that suffix in *return_period. */
+static Py_ssize_t
+STRINGLIB(_lex_search)(const STRINGLIB_CHAR *needle, Py_ssize_t len_needle,
+                       Py_ssize_t *return_period, int invert, int dir)
+{
+    /* Do a lexicographic search. Essentially this:
+           >>> max(needle[i:] for i in range(len(needle)+1))
+       Also find the period of the right half.   */
+    Py_ssize_t max_suffix = 0;
+    Py_ssize_t candidate = 1;
+    Py_ssize_t k = 0;
+    /* The period of the right half. */
+    Py_ssize_t period = 1;
+
+    while (candidate + k < len_needle) {
+        /* each loop increases candidate + k + max_suffix */
+        STRINGLIB_CHAR a = needle[(candidate + k) * dir];
+        STRINGLIB_CHAR b = needle[(max_suffix + k) * dir];
+        /* check if the suffix at candidate is better than max_suffix */
+        if (invert ? (b < a) : (a < b)) {
+            /* Fell short of max_suffix.
+               The next k + 1 characters are non-increasing
+               from candidate, so they won't start a maximal suffix. */
+            candidate += k + 1;
+            k = 0;
+            /* We've ruled out any period smaller than what's
+               been scanned since max_suffix. */
+            period = candidate - max_suffix;
+        }
+        else if (a == b) {
+            if (k + 1 != period) {
+                /* Keep scanning the equal strings */
+                k++;
+            }
+            else {
+                /* Matched a whole period.
+                   Start matching the next period. */
+                candidate += period;
+                k = 0;
+            }
+        }
+        else {
+            /* Did better than max_suffix, so replace it. */
+            max_suffix = candidate;
+            candidate++;
+            k = 0;
+            period = 1;
         }
     }
+    *return_period = period;
+    return max_suffix;
+}
 
-    mlast = m - 1;
-    skip = mlast - 1;
-    mask = 0;
+/* Compute a critical factorization of needle: return the cut, and store
+   the corresponding local period in *return_period.
+
+   The cut is the later of the starts of the maximal suffixes under both
+   orderings.  The Critical Factorization Theorem guarantees that the
+   local period at that cut is the global period of the needle. */
+static Py_ssize_t
+STRINGLIB(_factorize)(const STRINGLIB_CHAR *needle,
+                      Py_ssize_t len_needle,
+                      Py_ssize_t *return_period, int dir)
+{
+    Py_ssize_t cut1, period1, cut2, period2, cut, period;
+    cut1 = STRINGLIB(_lex_search)(needle, len_needle, &period1, 0, dir);
+    cut2 = STRINGLIB(_lex_search)(needle, len_needle, &period2, 1, dir);
 
-    if (mode != FAST_RSEARCH) {
-        const STRINGLIB_CHAR *ss = s + m - 1;
-        const STRINGLIB_CHAR *pp = p + m - 1;
+    /* Take the later cut. */
+    if (cut1 > cut2) {
+        period = period1;
+        cut = cut1;
+    }
+    else {
+        period = period2;
+        cut = cut2;
+    }
 
-        /* create compressed boyer-moore delta 1 table */
+    *return_period = period;
+    return cut;
+}
 
-        /* process pattern[:-1] */
-        for (i = 0; i < mlast; i++) {
-            STRINGLIB_BLOOM_ADD(mask, p[i]);
-            if (p[i] == p[mlast])
-                skip = mlast - i - 1;
+static void
+STRINGLIB(_preprocess)(const STRINGLIB_CHAR *needle, Py_ssize_t len_needle,
+                       STRINGLIB(prework) *p, int dir)
+{
+    Py_ssize_t i;
+
+    p->needle = needle;
+    p->len_needle = len_needle;
+    p->dir = dir;
+    p->cut = STRINGLIB(_factorize)(needle, len_needle, &(p->period), dir);
+    assert(p->period + p->cut <= len_needle);
+    if (dir > 0) {
+        p->is_periodic = (0 == memcmp(needle,
+                                      needle + p->period,
+                                      p->cut * STRINGLIB_SIZEOF_CHAR));
+    }
+    else {
+        for (i = 0; i < p->cut; i++) {
+            if (needle[-i] != needle[-(i + p->period)]) {
+                break;
+            }
         }
-        /* process pattern[-1] outside the loop */
-        STRINGLIB_BLOOM_ADD(mask, p[mlast]);
-
-        for (i = 0; i <= w; i++) {
-            /* note: using mlast in the skip path slows things down on x86 */
-            if (ss[i] == pp[0]) {
-                /* candidate match */
-                for (j = 0; j < mlast; j++)
-                    if (s[i+j] != p[j])
-                        break;
-                if (j == mlast) {
-                    /* got a match! */
-                    if (mode != FAST_COUNT)
-                        return i;
-                    count++;
-                    if (count == maxcount)
-                        return maxcount;
-                    i = i + mlast;
-                    continue;
-                }
-                /* miss: check if next character is part of pattern */
-                if (!STRINGLIB_BLOOM(mask, ss[i+1]))
-                    i = i + m;
-                else
-                    i = i + skip;
-            } else {
-                /* skip: check if next character is part of pattern */
-                if (!STRINGLIB_BLOOM(mask, ss[i+1]))
-                    i = i + m;
+        p->is_periodic = (i == p->cut);
+    }
+    if (!p->is_periodic) {
+        /* A lower bound on the shift after a full match of the right
+           half that mismatches in the left half. */
+        p->period = Py_MAX(p->cut, len_needle - p->cut) + 1;
+    }
+    /* Horspool-style shift table, indexed by the low bits of the
+       character at the end of the window.  Later occurrences overwrite
+       earlier ones, so each entry is the smallest safe shift among all
+       characters sharing those low bits. */
+    for (i = 0; i < (Py_ssize_t)STRINGLIB_TWO_WAY_TABLE_SIZE; i++) {
+        p->table[i] = len_needle;
+    }
+    for (i = 0; i < len_needle; i++) {
+        p->table[needle[i * dir] & STRINGLIB_TWO_WAY_TABLE_MASK] =
+            len_needle - 1 - i;
+    }
+}
+
+/* Return the index of the first occurrence of the preprocessed needle in
+   haystack[:len_haystack], or -1.  If dir is -1, haystack points to the
+   last character and the index counts back from there; the needle must
+   have been preprocessed with the same dir.  dir is a constant at every
+   call site, so the compiler specializes the loops for it. */
+Py_LOCAL_INLINE(Py_ssize_t)
+STRINGLIB(_two_way)(const STRINGLIB_CHAR *haystack, Py_ssize_t len_haystack,
+                    STRINGLIB(prework) *p, const int dir)
+{
+    const STRINGLIB_CHAR *const needle = p->needle;
+    const Py_ssize_t m = p->len_needle;
+    const Py_ssize_t cut = p->cut;
+    const Py_ssize_t period = p->period;
+    const Py_ssize_t *const table = p->table;
+    const Py_ssize_t w = len_haystack - m;
+    Py_ssize_t i, j, shift;
+
+    assert(p->dir == dir);
+    if (w < 0) {
+        return -1;
+    }
+
+    if (p->is_periodic) {
+        /* The needle is periodic: after a match of the right half, the
+           next alignment to try is one period later, and its first
+           m - period characters are already known to match. */
+        Py_ssize_t memory = 0;
+        j = 0;
+        while (j <= w) {
+            shift = table[haystack[(j + m - 1) * dir]
+                          & STRINGLIB_TWO_WAY_TABLE_MASK];
+            if (shift > 0) {
+                memory = 0;
+                j += shift;
+                continue;
             }
+            /* Scan for matches in the right half. */
+            i = Py_MAX(cut, memory);
+            while (i < m &&
+                   needle[i * dir] == haystack[(j + i) * dir]) {
+                i++;
+            }
+            if (i < m) {
+                j += i - cut + 1;
+                memory = 0;
+                continue;
+            }
+            /* Scan for matches in the left half. */
+            i = cut - 1;
+            while (i >= memory &&
+                   needle[i * dir] == haystack[(j + i) * dir]) {
+                i--;
+            }
+            if (i < memory) {
+                return j;
+            }
+            j += period;
+            memory = m - period;
         }
-    } else {    /* FAST_RSEARCH */
+    }
+    else {
+        j = 0;
+        while (j <= w) {
+            shift = table[haystack[(j + m - 1) * dir]
+                          & STRINGLIB_TWO_WAY_TABLE_MASK];
+            if (shift > 0) {
+                j += shift;
+                continue;
+            }
+            /* Scan for matches in the right half. */
+            i = cut;
+            while (i < m &&
+                   needle[i * dir] == haystack[(j + i) * dir]) {
+                i++;
+            }
+            if (i < m) {
+                j += i - cut + 1;
+                continue;
+            }
+            /* Scan for matches in the left half. */
+            i = cut - 1;
+            while (i >= 0 &&
+                   needle[i * dir] == haystack[(j + i) * dir]) {
+                i--;
+            }
+            if (i < 0) {
+                return j;
+            }
+            j += period;
+        }
+    }
+    return -1;
+}
 
-        /* create compressed boyer-moore delta 1 table */
+static Py_ssize_t
+STRINGLIB(_two_way_find)(const STRINGLIB_CHAR *haystack,
+                         Py_ssize_t len_haystack,
+                         const STRINGLIB_CHAR *needle,
+                         Py_ssize_t len_needle)
+{
+    STRINGLIB(prework) p;
+    STRINGLIB(_preprocess)(needle, len_needle, &p, 1);
+    return STRINGLIB(_two_way)(haystack, len_haystack, &p, 1);
+}
 
-        /* process pattern[0] outside the loop */
-        STRINGLIB_BLOOM_ADD(mask, p[0]);
-        /* process pattern[:0:-1] */
-        for (i = mlast; i > 0; i--) {
-            STRINGLIB_BLOOM_ADD(mask, p[i]);
-            if (p[i] == p[0])
-                skip = i - 1;
+static Py_ssize_t
+STRINGLIB(_two_way_rfind)(const STRINGLIB_CHAR *haystack,
+                          Py_ssize_t len_haystack,
+                          const STRINGLIB_CHAR *needle,
+                          Py_ssize_t len_needle)
+{
+    STRINGLIB(prework) p;
+    Py_ssize_t res;
+    STRINGLIB(_preprocess)(needle + len_needle - 1, len_needle, &p, -1);
+    res = STRINGLIB(_two_way)(haystack + len_haystack - 1, len_haystack,
+                              &p, -1);
+    return res == -1 ? -1 : len_haystack - len_needle - res;
+}
+
+static Py_ssize_t
+STRINGLIB(_two_way_count)(const STRINGLIB_CHAR *haystack,
+                          Py_ssize_t len_haystack,
+                          const STRINGLIB_CHAR *needle,
+                          Py_ssize_t len_needle,
+                          Py_ssize_t maxcount)
+{
+    STRINGLIB(prework) p;
+    STRINGLIB(_preprocess)(needle, len_needle, &p, 1);
+    Py_ssize_t index = 0, count = 0;
+    while (1) {
+        Py_ssize_t result;
+        result = STRINGLIB(_two_way)(haystack + index,
+                                     len_haystack - index, &p, 1);
+        if (result == -1) {
+            return count;
+        }
+        count++;
+        if (count == maxcount) {
+            return maxcount;
         }
+        index += result + len_needle;
+    }
+    return count;
+}
+
+#undef STRINGLIB_TWO_WAY_TABLE_SIZE_BITS
+#undef STRINGLIB_TWO_WAY_TABLE_SIZE
+#undef STRINGLIB_TWO_WAY_TABLE_MASK
+
+/* Horspool with a bloom filter, switching to two-way if it gets into
+   trouble.  This is the historical algorithm; it has very low startup
+   cost and is very fast on typical inputs, but is O(n*m) on adversarial
+   or highly repetitive ones.  Once the character comparisons made on
+   partial matches add up to the needle length, preprocessing for two-way
+   is cheap in comparison, so the rest of the haystack is searched with
+   that -- unless the remaining alignments can't cost more than
+   STRINGLIB_HORSPOOL_MAX_WORK comparisons even in the worst case, which
+   keeps short needles, whose partial matches are frequent but cheap, on
+   Horspool. */
+
+#define STRINGLIB_HORSPOOL_MAX_WORK 32768
+
+static Py_ssize_t
+STRINGLIB(default_find)(const STRINGLIB_CHAR* s, Py_ssize_t n,
+                        const STRINGLIB_CHAR* p, Py_ssize_t m,
+                        Py_ssize_t maxcount, int mode)
+{
+    const Py_ssize_t w = n - m;
+    const Py_ssize_t mlast = m - 1;
+    const Py_ssize_t max_rest = STRINGLIB_HORSPOOL_MAX_WORK / m;
+    Py_ssize_t count = 0;
+    Py_ssize_t i, j, skip, hits = 0;
+    unsigned long mask = 0;
+    const STRINGLIB_CHAR *ss = s + m - 1;
+    const STRINGLIB_CHAR *pp = p + m - 1;
+
+    /* create compressed boyer-moore delta 1 table */
+    skip = mlast - 1;
+
+    /* process pattern[:-1] */
+    for (i = 0; i < mlast; i++) {
+        STRINGLIB_BLOOM_ADD(mask, p[i]);
+        if (p[i] == p[mlast])
+            skip = mlast - i - 1;
+    }
+    /* process pattern[-1] outside the loop */
+    STRINGLIB_BLOOM_ADD(mask, p[mlast]);
 
-        for (i = w; i >= 0; i--) {
-            if (s[i] == p[0]) {
-                /* candidate match */
-                for (j = mlast; j > 0; j--)
-                    if (s[i+j] != p[j])
-                        break;
-                if (j == 0)
-                    /* got a match! */
+    for (i = 0; i <= w; i++) {
+        /* note: using mlast in the skip path slows things down on x86 */
+        if (ss[i] == pp[0]) {
+            /* candidate match */
+            for (j = 0; j < mlast; j++)
+                if (s[i+j] != p[j])
+                    break;
+            if (j == mlast) {
+                /* got a match! */
+                if (mode != FAST_COUNT)
                     return i;
-                /* miss: check if previous character is part of pattern */
-                if (i > 0 && !STRINGLIB_BLOOM(mask, s[i-1]))
-                    i = i - m;
-                else
-                    i = i - skip;
-            } else {
-                /* skip: check if previous character is part of pattern */
-                if (i > 0 && !STRINGLIB_BLOOM(mask, s[i-1]))
-                    i = i - m;
+                count++;
+                if (count == maxcount)
+                    return maxcount;
+                i = i + mlast;
+                continue;
+            }
+            /* miss: give up on Horspool if it's doing too much work */
+            hits += j + 1;
+            if (hits >= m && w - i > max_rest) {
+                Py_ssize_t res;
+                if (mode == FAST_SEARCH) {
+                    res = STRINGLIB(_two_way_find)(s + i, n - i, p, m);
+                    return res == -1 ? -1 : res + i;
+                }
+                res = STRINGLIB(_two_way_count)(s + i, n - i, p, m,
+                                                maxcount - count);
+                return res + count;
             }
+            /* miss: check if next character is part of pattern */
+            if (!STRINGLIB_BLOOM(mask, ss[i+1]))
+                i = i + m;
+            else
+                i = i + skip;
+        } else {
+            /* skip: check if next character is part of pattern */
+            if (!STRINGLIB_BLOOM(mask, ss[i+1]))
+                i = i + m;
         }
     }
 
@@ -281,3 +563,121 @@ FASTSEARCH(const STRINGLIB_CHAR* s, Py_ssize_t n,
     return count;
 }
 
+
+/* The mirror image of default_find(), for FAST_RSEARCH. */
+static Py_ssize_t
+STRINGLIB(default_rfind)(const STRINGLIB_CHAR* s, Py_ssize_t n,
+                         const STRINGLIB_CHAR* p, Py_ssize_t m)
+{
+    /* create compressed boyer-moore delta 1 table */
+    unsigned long mask = 0;
+    Py_ssize_t i, j, mlast = m - 1, skip = m - 2, w = n - m, hits = 0;
+    const Py_ssize_t max_rest = STRINGLIB_HORSPOOL_MAX_WORK / m;
+
+    /* process pattern[0] outside the loop */
+    STRINGLIB_BLOOM_ADD(mask, p[0]);
+    /* process pattern[:0:-1] */
+    for (i = mlast; i > 0; i--) {
+        STRINGLIB_BLOOM_ADD(mask, p[i]);
+        if (p[i] == p[0])
+            skip = i - 1;
+    }
+
+    for (i = w; i >= 0; i--) {
+        if (s[i] == p[0]) {
+            /* candidate match */
+            for (j = mlast; j > 0; j--)
+                if (s[i+j] != p[j])
+                    break;
+            if (j == 0)
+                /* got a match! */
+                return i;
+            /* miss: give up on Horspool if it's doing too much work */
+            hits += m - j;
+            if (hits >= m && i > max_rest) {
+                /* Alignments i and up are ruled out. */
+                return STRINGLIB(_two_way_rfind)(s, i + mlast, p, m);
+            }
+            /* miss: check if previous character is part of pattern */
+            if (i > 0 && !STRINGLIB_BLOOM(mask, s[i-1]))
+                i = i - m;
+            else
+                i = i - skip;
+        } else {
+            /* skip: check if previous character is part of pattern */
+            if (i > 0 && !STRINGLIB_BLOOM(mask, s[i-1]))
+                i = i - m;
+        }
+    }
+    return -1;
+}
+
+#undef STRINGLIB_HORSPOOL_MAX_WORK
+
+
+static inline Py_ssize_t
+STRINGLIB(count_char)(const STRINGLIB_CHAR *s, Py_ssize_t n,
+                      const STRINGLIB_CHAR p0, Py_ssize_t maxcount)
+{
+    Py_ssize_t i, count = 0;
+    for (i = 0; i < n; i++) {
+        if (s[i] == p0) {
+            count++;
+            if (count == maxcount) {
+                return maxcount;
+            }
+        }
+    }
+    return count;
+}
+
+
+Py_LOCAL_INLINE(Py_ssize_t)
+FASTSEARCH(const STRINGLIB_CHAR* s, Py_ssize_t n,
+           const STRINGLIB_CHAR* p, Py_ssize_t m,
+           Py_ssize_t maxcount, int mode)
+{
+    if (n < m || (mode == FAST_COUNT && maxcount == 0)) {
+        return -1;
+    }
+
+    /* look for special cases */
+    if (m <= 1) {
+        if (m <= 0) {
+            return -1;
+        }
+        /* use special case for 1-character strings */
+        if (mode == FAST_SEARCH)
+            return STRINGLIB(find_char)(s, n, p[0]);
+        else if (mode == FAST_RSEARCH)
+            return STRINGLIB(rfind_char)(s, n, p[0]);
+        else {
+            return STRINGLIB(count_char)(s, n, p[0], maxcount);
+        }
+    }
+
+    /* The cutoffs below come from timing both algorithms on Python
+       source text.  Horspool bails out to two-way by itself if the input
+       turns out to be pathological, so they only trade typical-case
+       speed: two-way's preprocessing has to pay off. */
+    if (mode == FAST_RSEARCH) {
+        /* Searching backwards, Horspool was up to twice as fast as
+           two-way for needles under 100 characters in haystacks under
+           30000; elsewhere the two were even. */
+        if (n < 2500 || (m < 100 && n < 30000) || m < 6) {
+            return STRINGLIB(default_rfind)(s, n, p, m);
+        }
+        return STRINGLIB(_two_way_rfind)(s, n, p, m);
+    }
+    /* Searching forwards, two-way was 20-35% faster for needles of 30
+       characters or more once the haystack reached 2500 characters. */
+    if (n < 2500 || m < 30) {
+        return STRINGLIB(default_find)(s, n, p, m, maxcount, mode);
+    }
+    if (mode == FAST_SEARCH) {
+        return STRINGLIB(_two_way_find)(s, n, p, m);
+    }
+    else {
+        return STRINGLIB(_two_way_count)(s, n, p, m, maxcount);
+    }
+}
@@ -12319,6 +12319,9 @@ unicode_isalpha_impl(PyObject *self)
 
     if (PyUnicode_READY(self) == -1)
         return NULL;
+    if (PyUnicode_IS_ASCII(self))
+        return _Py_bytes_isalpha(PyUnicode_DATA(self),
+                                 PyUnicode_GET_LENGTH(self));
     length = PyUnicode_GET_LENGTH(self);
     kind = PyUnicode_KIND(self);
     data = PyUnicode_DATA(self);
@@ -12358,6 +12361,9 @@ unicode_isalnum_impl(PyObject *self)
 
     if (PyUnicode_READY(self) == -1)
         return NULL;
+    if (PyUnicode_IS_ASCII(self))
+        return _Py_bytes_isalnum(PyUnicode_DATA(self),
+                                 PyUnicode_GET_LENGTH(self));
 
     kind = PyUnicode_KIND(self);
     data = PyUnicode_DATA(self);
@@ -12400,6 +12406,9 @@ unicode_isdecimal_impl(PyObject *self)
 
     if (PyUnicode_READY(self) == -1)
         return NULL;
+    if (PyUnicode_IS_ASCII(self))
+        return _Py_bytes_isdigit(PyUnicode_DATA(self),
+                                 PyUnicode_GET_LENGTH(self));
     length = PyUnicode_GET_LENGTH(self);
     kind = PyUnicode_KIND(self);
     data = PyUnicode_DATA(self);
@@ -12439,6 +12448,9 @@ unicode_isdigit_impl(PyObject *self)
 
     if (PyUnicode_READY(self) == -1)
         return NULL;
+    if (PyUnicode_IS_ASCII(self))
+        return _Py_bytes_isdigit(PyUnicode_DATA(self),
+                                 PyUnicode_GET_LENGTH(self));
     length = PyUnicode_GET_LENGTH(self);
     kind = PyUnicode_KIND(self);
     data = PyUnicode_DATA(self);
@@ -12479,6 +12491,9 @@ unicode_isnumeric_impl(PyObject *self)
 
     if (PyUnicode_READY(self) == -1)
         return NULL;
+    if (PyUnicode_IS_ASCII(self))
+        return _Py_bytes_isdigit(PyUnicode_DATA(self),
+                                 PyUnicode_GET_LENGTH(self));
     length = PyUnicode_GET_LENGTH(self);
     kind = PyUnicode_KIND(self);
     data = PyUnicode_DATA(self);
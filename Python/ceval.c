@@ -82,7 +82,8 @@ static int import_all_from(PyThreadState *, PyObject *, PyObject *);
 static void format_exc_check_arg(PyThreadState *, PyObject *, const char *, PyObject *);
 static void format_exc_unbound(PyThreadState *tstate, PyCodeObject *co, int oparg);
 static PyObject * unicode_concatenate(PyThreadState *, PyObject *, PyObject *,
-                                      PyFrameObject *, const _Py_CODEUNIT *);
+                                      PyFrameObject *, const _Py_CODEUNIT *,
+                                      PyObject **);
 static PyObject * special_lookup(PyThreadState *, PyObject *, _Py_Identifier *);
 static int check_args_iterable(PyThreadState *, PyObject *func, PyObject *vararg);
 static void format_kwargs_error(PyThreadState *, PyObject *func, PyObject *kwargs);
@@ -1851,7 +1852,8 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
                speedup on microbenchmarks. */
             if (PyUnicode_CheckExact(left) &&
                      PyUnicode_CheckExact(right)) {
-                sum = unicode_concatenate(tstate, left, right, f, next_instr);
+                sum = unicode_concatenate(tstate, left, right, f, next_instr,
+                                          stack_pointer);
                 /* unicode_concatenate consumed the ref to left */
             }
             else {
@@ -2050,7 +2052,8 @@ _PyEval_EvalFrameDefault(PyThreadState *tstate, PyFrameObject *f, int throwflag)
             PyObject *left = TOP();
             PyObject *sum;
             if (PyUnicode_CheckExact(left) && PyUnicode_CheckExact(right)) {
-                sum = unicode_concatenate(tstate, left, right, f, next_instr);
+                sum = unicode_concatenate(tstate, left, right, f, next_instr,
+                                          stack_pointer);
                 /* unicode_concatenate consumed the ref to left */
             }
             else {
@@ -5944,7 +5947,8 @@ format_awaitable_error(PyThreadState *tstate, PyTypeObject *type, int prevprevop
 
 static PyObject *
 unicode_concatenate(PyThreadState *tstate, PyObject *v, PyObject *w,
-                    PyFrameObject *f, const _Py_CODEUNIT *next_instr)
+                    PyFrameObject *f, const _Py_CODEUNIT *next_instr,
+                    PyObject **stack_pointer)
 {
     PyObject *res;
     if (Py_REFCNT(v) == 2) {
@@ -5953,6 +5957,10 @@ unicode_concatenate(PyThreadState *tstate, PyObject *v, PyObject *w,
          * value stack (in 'v') and one still stored in the
          * 'variable'.  We try to delete the variable now to reduce
          * the refcnt to 1.
+         *
+         * stack_pointer[-1] is v; for augmented assignments to an
+         * attribute or a subscript, the object (and the subscript)
+         * are just below it.
          */
         int opcode, oparg;
         NEXTOPARG();
@@ -5991,6 +5999,96 @@ unicode_concatenate(PyThreadState *tstate, PyObject *v, PyObject *w,
             }
             break;
         }
+        case STORE_GLOBAL:
+        {
+            PyObject *names = f->f_code->co_names;
+            PyObject *name = GETITEM(names, oparg);
+            PyObject *globals = f->f_globals;
+            if (PyDict_CheckExact(globals)) {
+                PyObject *w = PyDict_GetItemWithError(globals, name);
+                if ((w == v && PyDict_DelItem(globals, name) != 0) ||
+                    (w == NULL && _PyErr_Occurred(tstate)))
+                {
+                    Py_DECREF(v);
+                    return NULL;
+                }
+            }
+            break;
+        }
+        case ROT_TWO:
+        {
+            /* "owner.name += w" ends with ROT_TWO; STORE_ATTR.  If the
+               attribute lives in the instance dict and will be stored
+               back there, replace it with None for the time being. */
+            PyObject *owner = stack_pointer[-2];
+            PyTypeObject *tp = Py_TYPE(owner);
+            PyObject *name, *descr, **dictptr, *dict, *w;
+            NEXTOPARG();
+            if (opcode != STORE_ATTR ||
+                tp->tp_setattro != PyObject_GenericSetAttr)
+            {
+                break;
+            }
+            name = GETITEM(f->f_code->co_names, oparg);
+            descr = _PyType_Lookup(tp, name);
+            if (descr != NULL && Py_TYPE(descr)->tp_descr_set != NULL) {
+                break;
+            }
+            dictptr = _PyObject_GetDictPtr(owner);
+            if (dictptr == NULL || (dict = *dictptr) == NULL ||
+                !PyDict_CheckExact(dict))
+            {
+                break;
+            }
+            w = PyDict_GetItemWithError(dict, name);
+            if ((w == v && PyDict_SetItem(dict, name, Py_None) != 0) ||
+                (w == NULL && _PyErr_Occurred(tstate)))
+            {
+                Py_DECREF(v);
+                return NULL;
+            }
+            break;
+        }
+        case ROT_THREE:
+        {
+            /* "container[sub] += w" ends with ROT_THREE; STORE_SUBSCR.
+               Handle dicts with str keys and lists with int indices,
+               whose item assignment can't run arbitrary code. */
+            PyObject *container = stack_pointer[-3];
+            PyObject *sub = stack_pointer[-2];
+            NEXTOPARG();
+            if (opcode != STORE_SUBSCR) {
+                break;
+            }
+            if (PyDict_CheckExact(container) && PyUnicode_CheckExact(sub)) {
+                PyObject *w = PyDict_GetItemWithError(container, sub);
+                if ((w == v && PyDict_SetItem(container, sub, Py_None) != 0) ||
+                    (w == NULL && _PyErr_Occurred(tstate)))
+                {
+                    Py_DECREF(v);
+                    return NULL;
+                }
+            }
+            else if (PyList_CheckExact(container) && PyLong_CheckExact(sub)) {
+                Py_ssize_t i = PyLong_AsSsize_t(sub);
+                if (i == -1 && _PyErr_Occurred(tstate)) {
+                    /* Leave the error to STORE_SUBSCR. */
+                    _PyErr_Clear(tstate);
+                    break;
+                }
+                if (i < 0) {
+                    i += PyList_GET_SIZE(container);
+                }
+                if (0 <= i && i < PyList_GET_SIZE(container) &&
+                    PyList_GET_ITEM(container, i) == v)
+                {
+                    Py_INCREF(Py_None);
+                    PyList_SET_ITEM(container, i, Py_None);
+                    Py_DECREF(v);
+                }
+            }
+            break;
+        }
         }
     }
     res = v;
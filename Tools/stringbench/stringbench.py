@@ -1390,6 +1390,41 @@ def upper_conversion_dense(STR):
         s_upper()
 
 
+####### hashing
+
+# Hashes of str and bytes objects are cached, so each key is sliced to get
+# a fresh object with the same length distribution.  Compare builds
+# configured with different --with-hash-algorithm values.
+
+_IDENTIFIERS = ("id name type value key data x y self args kwargs result "
+                "items index count timestamp user_id created_at status "
+                "message content_type").split()
+_MEDIUM_KEYS = ["/api/v1/users/%d/profile?fields=name,email" % i
+                for i in range(10)]
+
+@bench('hash(s[1:]) for 20 identifier-like keys',
+       "hash -- identifier-like keys (1-12 characters)", 1000)
+def hash_identifiers(STR):
+    keys = [STR("_" + k) for k in _IDENTIFIERS]
+    for x in _RANGE_1000:
+        for k in keys:
+            hash(k[1:])
+
+@bench('hash(s[1:]) for 10 URL-like keys',
+       "hash -- medium keys (40-50 characters)", 1000)
+def hash_medium_keys(STR):
+    keys = list(map(STR, _MEDIUM_KEYS))
+    for x in _RANGE_1000:
+        for k in keys:
+            hash(k[1:])
+
+@bench('hash(s[1:]) for "A"*1000', "hash -- long key", 1000)
+def hash_long_key(STR):
+    s = STR("A" * 1000)
+    for x in _RANGE_1000:
+        hash(s[1:])
+
+
 # end of benchmarks
 
 #################